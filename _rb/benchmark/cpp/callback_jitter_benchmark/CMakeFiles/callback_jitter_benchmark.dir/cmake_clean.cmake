@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../callback_jitter_benchmark"
+  "../../../callback_jitter_benchmark.pdb"
+  "CMakeFiles/callback_jitter_benchmark.dir/callback_jitter_benchmark.cpp.o"
+  "CMakeFiles/callback_jitter_benchmark.dir/callback_jitter_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/callback_jitter_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
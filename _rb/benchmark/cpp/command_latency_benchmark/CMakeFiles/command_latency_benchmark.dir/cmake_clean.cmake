@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../command_latency_benchmark"
+  "../../../command_latency_benchmark.pdb"
+  "CMakeFiles/command_latency_benchmark.dir/command_latency_benchmark.cpp.o"
+  "CMakeFiles/command_latency_benchmark.dir/command_latency_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/command_latency_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
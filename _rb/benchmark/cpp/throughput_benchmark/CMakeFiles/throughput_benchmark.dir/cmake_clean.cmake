@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../throughput_benchmark"
+  "../../../throughput_benchmark.pdb"
+  "CMakeFiles/throughput_benchmark.dir/throughput_benchmark.cpp.o"
+  "CMakeFiles/throughput_benchmark.dir/throughput_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/throughput_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
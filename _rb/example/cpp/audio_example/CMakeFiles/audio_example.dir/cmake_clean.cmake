@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../audio_example"
+  "../../../audio_example.pdb"
+  "CMakeFiles/audio_example.dir/audio_example.cpp.o"
+  "CMakeFiles/audio_example.dir/audio_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/audio_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../high_level_motion_example"
+  "../../../high_level_motion_example.pdb"
+  "CMakeFiles/high_level_motion_example.dir/high_level_motion_example.cpp.o"
+  "CMakeFiles/high_level_motion_example.dir/high_level_motion_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/high_level_motion_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../low_level_motion_example"
+  "../../../low_level_motion_example.pdb"
+  "CMakeFiles/low_level_motion_example.dir/low_level_motion_example.cpp.o"
+  "CMakeFiles/low_level_motion_example.dir/low_level_motion_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/low_level_motion_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../monitor_example"
+  "../../../monitor_example.pdb"
+  "CMakeFiles/monitor_example.dir/monitor_example.cpp.o"
+  "CMakeFiles/monitor_example.dir/monitor_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/monitor_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../sensor_example"
+  "../../../sensor_example.pdb"
+  "CMakeFiles/sensor_example.dir/sensor_example.cpp.o"
+  "CMakeFiles/sensor_example.dir/sensor_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sensor_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
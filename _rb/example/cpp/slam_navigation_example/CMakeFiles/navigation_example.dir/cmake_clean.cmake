@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../navigation_example"
+  "../../../navigation_example.pdb"
+  "CMakeFiles/navigation_example.dir/navigation_example.cpp.o"
+  "CMakeFiles/navigation_example.dir/navigation_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/navigation_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../slam_example"
+  "../../../slam_example.pdb"
+  "CMakeFiles/slam_example.dir/slam_example.cpp.o"
+  "CMakeFiles/slam_example.dir/slam_example.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slam_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
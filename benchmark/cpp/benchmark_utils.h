@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace magic::z1::benchmark {
+
+/**
+ * @brief Collects nanosecond samples and emits machine-readable statistics
+ *
+ * Samples are kept in a preallocated vector so recording on a hot path costs one store.
+ * The emitted JSON contains count, min/mean/max, the common percentiles and a log2
+ * histogram, so CI can diff distributions between SDK releases rather than averages.
+ */
+class LatencyRecorder {
+ public:
+  explicit LatencyRecorder(std::string name, size_t capacity = 1 << 20)
+      : name_(std::move(name)) {
+    samples_.reserve(capacity);
+  }
+
+  /// Record one sample (unit: nanoseconds). Thread-safe.
+  void Add(int64_t ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (samples_.size() < samples_.capacity()) {
+      samples_.push_back(ns);
+    } else {
+      dropped_++;
+    }
+  }
+
+  size_t Count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return samples_.size();
+  }
+
+  /**
+   * @brief Append this recorder's statistics as one JSON object to the stream.
+   */
+  void WriteJson(std::ostream& os) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::sort(samples_.begin(), samples_.end());
+
+    os << "    {\n";
+    os << "      \"name\": \"" << name_ << "\",\n";
+    os << "      \"count\": " << samples_.size() << ",\n";
+    os << "      \"dropped_samples\": " << dropped_ << ",\n";
+    if (!samples_.empty()) {
+      int64_t sum = 0;
+      for (int64_t s : samples_) sum += s;
+      os << "      \"min_ns\": " << samples_.front() << ",\n";
+      os << "      \"mean_ns\": " << sum / static_cast<int64_t>(samples_.size()) << ",\n";
+      os << "      \"p50_ns\": " << Percentile(0.50) << ",\n";
+      os << "      \"p90_ns\": " << Percentile(0.90) << ",\n";
+      os << "      \"p99_ns\": " << Percentile(0.99) << ",\n";
+      os << "      \"p999_ns\": " << Percentile(0.999) << ",\n";
+      os << "      \"max_ns\": " << samples_.back() << ",\n";
+    }
+    os << "      \"log2_histogram\": [";
+    std::array<uint64_t, 64> buckets{};
+    for (int64_t s : samples_) {
+      int bucket = 0;
+      for (int64_t v = s; v > 1; v >>= 1) bucket++;
+      buckets[bucket]++;
+    }
+    size_t last = 0;
+    for (size_t ii = 0; ii < buckets.size(); ii++) {
+      if (buckets[ii] > 0) last = ii;
+    }
+    for (size_t ii = 0; ii <= last; ii++) {
+      os << buckets[ii] << (ii == last ? "" : ", ");
+    }
+    os << "]\n";
+    os << "    }";
+  }
+
+ private:
+  // Requires samples_ sorted and mutex_ held.
+  int64_t Percentile(double p) const {
+    size_t index = static_cast<size_t>(p * static_cast<double>(samples_.size() - 1));
+    return samples_[index];
+  }
+
+  std::string name_;
+  mutable std::mutex mutex_;
+  std::vector<int64_t> samples_;
+  uint64_t dropped_ = 0;
+};
+
+/**
+ * @brief Write a set of recorders as one JSON report, e.g. for CI gating
+ */
+inline void WriteJsonReport(const std::string& path, const std::string& benchmark_name, std::vector<LatencyRecorder*> recorders) {
+  std::ofstream os(path);
+  os << "{\n";
+  os << "  \"benchmark\": \"" << benchmark_name << "\",\n";
+  os << "  \"recorders\": [\n";
+  for (size_t ii = 0; ii < recorders.size(); ii++) {
+    recorders[ii]->WriteJson(os);
+    os << (ii + 1 == recorders.size() ? "\n" : ",\n");
+  }
+  os << "  ]\n";
+  os << "}\n";
+}
+
+}  // namespace magic::z1::benchmark
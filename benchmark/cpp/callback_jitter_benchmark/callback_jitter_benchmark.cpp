@@ -0,0 +1,126 @@
+#include "magic_robot.h"
+#include "magic_sdk_version.h"
+
+#include "../benchmark_utils.h"
+
+#include <unistd.h>
+#include <csignal>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace magic::z1;
+using namespace magic::z1::benchmark;
+
+// Records the inter-arrival time of the body IMU, arm joint state and estimator state
+// callbacks for a fixed duration. The jitter of these distributions (p99 vs p50) shows
+// whether SDK-internal dispatch delays periodic topics.
+
+magic::z1::MagicRobot robot;
+
+std::atomic<bool> running(true);
+
+void signalHandler(int signum) {
+  std::cout << "Interrupt signal (" << signum << ") received.\n";
+  running = false;
+  robot.Shutdown();
+  exit(signum);
+}
+
+static int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Feeds the delta between consecutive callback arrivals into a recorder
+class InterArrivalProbe {
+ public:
+  explicit InterArrivalProbe(LatencyRecorder& recorder)
+      : recorder_(recorder) {}
+
+  void OnMessage() {
+    int64_t now_ns = NowNs();
+    int64_t previous_ns = previous_ns_.exchange(now_ns);
+    if (previous_ns != 0) {
+      recorder_.Add(now_ns - previous_ns);
+    }
+  }
+
+ private:
+  LatencyRecorder& recorder_;
+  std::atomic<int64_t> previous_ns_{0};
+};
+
+int main(int argc, char** argv) {
+  // Bind SIGINT (Ctrl+C)
+  signal(SIGINT, signalHandler);
+
+  std::cout << "SDK Version: " << SDK_VERSION_STRING << std::endl;
+
+  int duration_s = 60;
+  std::string report_path = "callback_jitter_report.json";
+  if (argc > 1) duration_s = std::atoi(argv[1]);
+  if (argc > 2) report_path = argv[2];
+
+  std::string local_ip = "192.168.54.111";
+  // Configure local IP address for direct ethernet connection to robot and initialize SDK
+  if (!robot.Initialize(local_ip)) {
+    std::cerr << "robot sdk initialize failed." << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto status = robot.Connect();
+  if (status.code != ErrorCode::OK) {
+    std::cerr << "connect robot failed"
+              << ", code: " << status.code
+              << ", message: " << status.message << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  status = robot.SetMotionControlLevel(ControllerLevel::LowLevel);
+  if (status.code != ErrorCode::OK) {
+    std::cerr << "switch robot motion control level failed"
+              << ", code: " << status.code
+              << ", message: " << status.message << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto& controller = robot.GetLowLevelMotionController();
+
+  LatencyRecorder imu_jitter("body_imu_inter_arrival");
+  LatencyRecorder arm_jitter("arm_joint_state_inter_arrival");
+  LatencyRecorder estimator_jitter("estimator_state_inter_arrival");
+
+  InterArrivalProbe imu_probe(imu_jitter);
+  InterArrivalProbe arm_probe(arm_jitter);
+  InterArrivalProbe estimator_probe(estimator_jitter);
+
+  controller.SubscribeBodyImu([&](const std::shared_ptr<Imu> msg) { imu_probe.OnMessage(); });
+  controller.SubscribeArmState([&](const std::shared_ptr<JointState> msg) { arm_probe.OnMessage(); });
+  controller.SubscribeEstimatorState([&](const std::shared_ptr<EstimatorState> msg) { estimator_probe.OnMessage(); });
+
+  for (int elapsed = 0; elapsed < duration_s && running.load(); elapsed++) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  controller.UnsubscribeBodyImu();
+  controller.UnsubscribeArmState();
+  controller.UnsubscribeEstimatorState();
+
+  WriteJsonReport(report_path, "callback_jitter", {&imu_jitter, &arm_jitter, &estimator_jitter});
+  std::cout << "report written to " << report_path
+            << " (imu samples: " << imu_jitter.Count()
+            << ", arm samples: " << arm_jitter.Count()
+            << ", estimator samples: " << estimator_jitter.Count() << ")" << std::endl;
+
+  robot.Disconnect();
+  robot.Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include "magic_robot.h"
+#include "magic_sdk_version.h"
+
+#include "../benchmark_utils.h"
+
+#include <unistd.h>
+#include <csignal>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace magic::z1;
+using namespace magic::z1::benchmark;
+
+// Measures, at the 500Hz control rate:
+//   - publish_cost:     time spent inside PublishArmCommand
+//   - round_trip:       command publish -> next SubscribeArmState callback
+// and writes a JSON report for CI gating.
+
+magic::z1::MagicRobot robot;
+
+std::atomic<bool> running(true);
+
+void signalHandler(int signum) {
+  std::cout << "Interrupt signal (" << signum << ") received.\n";
+  running = false;
+  robot.Shutdown();
+  exit(signum);
+}
+
+static int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int main(int argc, char** argv) {
+  // Bind SIGINT (Ctrl+C)
+  signal(SIGINT, signalHandler);
+
+  std::cout << "SDK Version: " << SDK_VERSION_STRING << std::endl;
+
+  int cycles = 30000;  // 60s at 500Hz
+  std::string report_path = "command_latency_report.json";
+  if (argc > 1) cycles = std::atoi(argv[1]);
+  if (argc > 2) report_path = argv[2];
+
+  std::string local_ip = "192.168.54.111";
+  // Configure local IP address for direct ethernet connection to robot and initialize SDK
+  if (!robot.Initialize(local_ip)) {
+    std::cerr << "robot sdk initialize failed." << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto status = robot.Connect();
+  if (status.code != ErrorCode::OK) {
+    std::cerr << "connect robot failed"
+              << ", code: " << status.code
+              << ", message: " << status.message << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  // Low-level control is required for joint command publishing
+  status = robot.SetMotionControlLevel(ControllerLevel::LowLevel);
+  if (status.code != ErrorCode::OK) {
+    std::cerr << "switch robot motion control level failed"
+              << ", code: " << status.code
+              << ", message: " << status.message << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto& controller = robot.GetLowLevelMotionController();
+
+  LatencyRecorder publish_cost("publish_cost");
+  LatencyRecorder round_trip("command_to_state_round_trip");
+
+  // Timestamp of the most recent publish, consumed by the state callback
+  std::atomic<int64_t> last_publish_ns(0);
+
+  controller.SubscribeArmState([&](const std::shared_ptr<JointState> msg) {
+    int64_t publish_ns = last_publish_ns.exchange(0);
+    if (publish_ns != 0) {
+      round_trip.Add(NowNs() - publish_ns);
+    }
+  });
+
+  // Keep all joints in the ready state; the benchmark measures transport cost, not motion
+  JointCommand arm_command;
+  arm_command.joints.resize(kArmJointNum);
+  for (int ii = 0; ii < kArmJointNum; ii++) {
+    arm_command.joints[ii].operation_mode = 200;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  for (int cycle = 0; cycle < cycles && running.load(); cycle++) {
+    int64_t begin_ns = NowNs();
+    controller.PublishArmCommand(arm_command);
+    int64_t end_ns = NowNs();
+
+    publish_cost.Add(end_ns - begin_ns);
+    last_publish_ns.store(begin_ns);
+
+    // Publish at 500Hz frequency (2ms)
+    now += std::chrono::microseconds(2000);
+    std::this_thread::sleep_until(now);
+  }
+
+  controller.UnsubscribeArmState();
+
+  WriteJsonReport(report_path, "command_latency", {&publish_cost, &round_trip});
+  std::cout << "report written to " << report_path
+            << " (publish samples: " << publish_cost.Count()
+            << ", round-trip samples: " << round_trip.Count() << ")" << std::endl;
+
+  robot.Disconnect();
+  robot.Shutdown();
+
+  return 0;
+}
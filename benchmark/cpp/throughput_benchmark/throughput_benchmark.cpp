@@ -0,0 +1,120 @@
+#include "magic_robot.h"
+#include "magic_sdk_version.h"
+
+#include "../benchmark_utils.h"
+
+#include <unistd.h>
+#include <csignal>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace magic::z1;
+using namespace magic::z1::benchmark;
+
+// Measures delivered throughput (messages/s and bytes/s) of the bulk sensor streams:
+// lidar point cloud, head RGBD color image and binocular camera frames.
+
+magic::z1::MagicRobot robot;
+
+std::atomic<bool> running(true);
+
+void signalHandler(int signum) {
+  std::cout << "Interrupt signal (" << signum << ") received.\n";
+  running = false;
+  robot.Shutdown();
+  exit(signum);
+}
+
+// Message and byte counters for one sensor stream
+struct StreamCounter {
+  std::atomic<uint64_t> messages{0};
+  std::atomic<uint64_t> bytes{0};
+
+  void Print(const std::string& name, double elapsed_s) const {
+    double mps = static_cast<double>(messages.load()) / elapsed_s;
+    double mbps = static_cast<double>(bytes.load()) / elapsed_s / (1024.0 * 1024.0);
+    std::cout << "  \"" << name << "\": {\"messages_per_second\": " << mps
+              << ", \"mib_per_second\": " << mbps << "}";
+  }
+};
+
+int main(int argc, char** argv) {
+  // Bind SIGINT (Ctrl+C)
+  signal(SIGINT, signalHandler);
+
+  std::cout << "SDK Version: " << SDK_VERSION_STRING << std::endl;
+
+  int duration_s = 30;
+  if (argc > 1) duration_s = std::atoi(argv[1]);
+
+  std::string local_ip = "192.168.54.111";
+  // Configure local IP address for direct ethernet connection to robot and initialize SDK
+  if (!robot.Initialize(local_ip)) {
+    std::cerr << "robot sdk initialize failed." << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto status = robot.Connect();
+  if (status.code != ErrorCode::OK) {
+    std::cerr << "connect robot failed"
+              << ", code: " << status.code
+              << ", message: " << status.message << std::endl;
+    robot.Shutdown();
+    return -1;
+  }
+
+  auto& sensor_controller = robot.GetSensorController();
+
+  sensor_controller.OpenLidar();
+  sensor_controller.OpenHeadRgbdCamera();
+  sensor_controller.OpenBinocularCamera();
+
+  StreamCounter point_cloud_counter;
+  StreamCounter color_image_counter;
+  StreamCounter binocular_counter;
+
+  sensor_controller.SubscribeLidarPointCloud([&](const std::shared_ptr<PointCloud2> msg) {
+    point_cloud_counter.messages++;
+    point_cloud_counter.bytes += msg->data.size();
+  });
+  sensor_controller.SubscribeHeadRgbdColorImage([&](const std::shared_ptr<Image> msg) {
+    color_image_counter.messages++;
+    color_image_counter.bytes += msg->data.size();
+  });
+  sensor_controller.SubscribeBinocularImage([&](const std::shared_ptr<BinocularCameraFrame> msg) {
+    binocular_counter.messages++;
+    binocular_counter.bytes += msg->data.size();
+  });
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int elapsed = 0; elapsed < duration_s && running.load(); elapsed++) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+  double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  sensor_controller.UnsubscribeLidarPointCloud();
+  sensor_controller.UnsubscribeHeadRgbdColorImage();
+  sensor_controller.UnsubscribeBinocularImage();
+
+  sensor_controller.CloseLidar();
+  sensor_controller.CloseHeadRgbdCamera();
+  sensor_controller.CloseBinocularCamera();
+
+  // Machine-readable summary on stdout
+  std::cout << "{\n";
+  point_cloud_counter.Print("lidar_point_cloud", elapsed_s);
+  std::cout << ",\n";
+  color_image_counter.Print("head_rgbd_color_image", elapsed_s);
+  std::cout << ",\n";
+  binocular_counter.Print("binocular_image", elapsed_s);
+  std::cout << "\n}" << std::endl;
+
+  robot.Disconnect();
+  robot.Shutdown();
+
+  return 0;
+}
@@ -1,3 +1,4 @@
+#include "magic_rate.h"
 #include "magic_robot.h"
 #include "magic_sdk_version.h"
 
@@ -12,6 +13,9 @@ using namespace magic::z1;
 
 magic::z1::MagicRobot robot;
 
+// Paces the 500Hz (2ms) command loop with hybrid sleep/spin timing instead of plain sleep_until
+RateDriver rate(500.0);
+
 std::atomic<bool> running(true);
 
 void signalHandler(int signum) {
@@ -19,6 +23,11 @@ void signalHandler(int signum) {
 
   running = false;
 
+  // The process exits from this handler, so report the loop timing counters here
+  std::cout << "cycles: " << rate.CycleCount()
+            << ", deadline misses: " << rate.DeadlineMissCount()
+            << ", max lateness: " << rate.MaxLatenessNs() / 1000 << "us" << std::endl;
+
   robot.Shutdown();
   // Exit process
   exit(signum);
@@ -106,7 +115,7 @@ int main() {
 
   // Using arm joint control as an example:
   // Subsequent joint control commands, joint operation mode is 1, indicating joint is in position control mode
-  auto now = std::chrono::steady_clock::now();
+  rate.Reset();
   while (running.load()) {
     // Left arm joints, refer to documentation:
     // Left or right arm joints 1-5 operation_mode needs to switch from mode 200 to mode 4 (series PID mode) for command execution;
@@ -126,8 +135,7 @@ int main() {
     controller.PublishArmCommand(arm_command);
 
     // Send control commands at 500Hz frequency (2ms)
-    now += std::chrono::microseconds(2000);
-    std::this_thread::sleep_until(now);
+    rate.WaitNextCycle();
   }
 
   // Disconnect from robot
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -63,6 +64,15 @@ class MAGIC_EXPORT_API AudioController final : public NonCopyable {
    */
   Status Play(const TtsCommand& cmd, int timeout_ms = 10000);
 
+  /**
+   * @brief Asynchronous variant of Play, returns immediately.
+   * @param cmd TTS command containing text content, speech rate, tone and other parameters.
+   * @param timeout_ms Timeout time in milliseconds.
+   * @return Future resolving to the operation status once the request is accepted or times out.
+   * @note In-flight requests are pipelined on the existing connection, no thread is spawned per call.
+   */
+  std::future<Status> PlayAsync(const TtsCommand& cmd, int timeout_ms = 10000);
+
   /**
    * @brief Stop current audio playback.
    * @return Operation status, returns Status::OK on success.
@@ -83,12 +93,47 @@ class MAGIC_EXPORT_API AudioController final : public NonCopyable {
    */
   Status GetVolume(int& volume);
 
+  /**
+   * @brief Open a PCM playback stream for incremental audio upload.
+   * @param config PCM format of the pushed chunks.
+   * @return Operation status, returns Status::OK on success.
+   * @note Playback starts as soon as the first chunk arrives, so synthesized or recorded audio
+   *       can be streamed to the robot without buffering whole utterances first.
+   */
+  Status OpenPcmPlaybackStream(const PcmStreamConfig& config);
+
+  /**
+   * @brief Push one PCM chunk into the playback stream.
+   * @param chunk Audio chunk, raw_data holding data_length bytes in the configured PCM format.
+   * @param timeout_ms Timeout in milliseconds, default is 1000.
+   * @return Operation status. Flow control is credit-based: when the robot's playback buffer is
+   *         full the call blocks until credit is granted and returns TIMEOUT if none arrives
+   *         within timeout_ms.
+   */
+  Status PushPcmChunk(const AudioStream& chunk, int timeout_ms = 1000);
+
+  /**
+   * @brief Close the PCM playback stream, letting buffered audio finish playing.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status ClosePcmPlaybackStream();
+
   /**
    * @brief Open audio stream, prepare for audio playback.
    * @return Operation status, returns Status::OK on success.
    */
   Status OpenAudioStream();
 
+  /**
+   * @brief Open audio stream with voice-activity gating.
+   * @param options Gating options: enable flag and pre/post-roll durations.
+   * @return Operation status, returns Status::OK on success.
+   * @note With gating enabled the origin and BF audio subscriptions only receive frames around
+   *       detected voice activity (including the configured pre-roll, delivered retroactively
+   *       from the robot's ring buffer); silence is not transmitted at all.
+   */
+  Status OpenAudioStream(const VadGateOptions& options);
+
   /**
    * @brief Close audio stream.
    * @return Operation status, returns Status::OK on success.
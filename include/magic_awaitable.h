@@ -0,0 +1,256 @@
+#pragma once
+
+#include "magic_type.h"
+
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace magic::z1::awaitable {
+
+/**
+ * @brief Minimal fire-and-forget coroutine type for SDK awaitables
+ *
+ * Lets a plain function start a coroutine that drives robot logic with co_await. The coroutine
+ * runs eagerly until its first suspension and is destroyed when it finishes; exceptions escaping
+ * the coroutine terminate the process, mirroring an exception escaping a thread.
+ */
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+namespace detail {
+
+/**
+ * @brief Single shared waiter thread resuming coroutines whose futures became ready
+ *
+ * std::future offers no completion callback, so readiness has to be observed by a thread.
+ * Instead of one blocked thread per awaited RPC, all pending futures are polled by this one
+ * lazily started service; the polling interval bounds the added resume latency.
+ */
+class StatusWaitService {
+ public:
+  static StatusWaitService& Instance() {
+    static StatusWaitService service;
+    return service;
+  }
+
+  /// Register a suspended coroutine to be resumed once its future is ready.
+  /// The future must stay valid until resume (it lives in the suspended coroutine's frame).
+  void Watch(std::future<Status>* future, std::coroutine_handle<> handle) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.push_back(Entry{future, handle});
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  struct Entry {
+    std::future<Status>* future;
+    std::coroutine_handle<> handle;
+  };
+
+  StatusWaitService() { worker_ = std::thread([this] { Run(); }); }
+
+  ~StatusWaitService() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_one();
+    worker_.join();
+  }
+
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+      if (pending_.empty()) {
+        cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        continue;
+      }
+      std::vector<Entry> ready;
+      for (auto it = pending_.begin(); it != pending_.end();) {
+        if (it->future->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+          ready.push_back(*it);
+          it = pending_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      if (ready.empty()) {
+        cv_.wait_for(lock, std::chrono::microseconds(500));
+      } else {
+        lock.unlock();
+        for (Entry& entry : ready) {
+          entry.handle.resume();
+        }
+        lock.lock();
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Entry> pending_;
+  bool stop_ = false;
+  std::thread worker_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Awaitable adapter over the std::future<Status> returned by the *Async RPCs
+ *
+ * Usage:
+ * @code
+ *   Status status = co_await StatusAwaitable(controller.SetGaitAsync(GaitMode::GAIT_BALANCE_STAND));
+ * @endcode
+ *
+ * If the future is already ready the coroutine continues without suspending; otherwise it is
+ * resumed by a single shared waiter thread servicing all pending RPCs (started on first use),
+ * so the number of threads stays constant no matter how many awaits are in flight. Resumption
+ * happens on that waiter thread, within ~0.5ms of the RPC completing.
+ */
+class StatusAwaitable {
+ public:
+  explicit StatusAwaitable(std::future<Status> future)
+      : future_(std::move(future)) {}
+
+  bool await_ready() {
+    return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    // The awaitable lives in the suspended coroutine frame, so future_ stays valid until resume.
+    detail::StatusWaitService::Instance().Watch(&future_, handle);
+  }
+
+  Status await_resume() { return future_.get(); }
+
+ private:
+  std::future<Status> future_;
+};
+
+/**
+ * @brief Bounded channel turning a callback subscription into an awaitable message stream
+ *
+ * The subscription callback pushes into the channel; a coroutine consumes it with co_await:
+ * @code
+ *   MessageChannel<Imu> imu_channel(8);
+ *   controller.SubscribeBodyImu([&](const std::shared_ptr<Imu> msg) { imu_channel.Push(*msg); });
+ *   while (auto imu = co_await imu_channel.Next()) {
+ *     // ... fuse *imu ...
+ *   }
+ * @endcode
+ *
+ * The queue is bounded with drop-oldest semantics, so a slow coroutine sees bounded staleness
+ * instead of unbounded buffering. A waiting coroutine is resumed on the producer's thread (the
+ * SDK callback thread); keep per-message work short or hand off, exactly as with raw callbacks.
+ * Next() returns std::nullopt after Close(), ending consumption loops.
+ *
+ * The channel is single-consumer: at most one coroutine may be awaiting Next() at a time
+ * (asserted in debug builds); a second concurrent awaiter would displace the first, which
+ * would then never be resumed. Multiple producers are fine.
+ */
+template <typename T>
+class MessageChannel : public NonCopyable {
+ public:
+  explicit MessageChannel(size_t capacity = 1)
+      : capacity_(capacity == 0 ? 1 : capacity) {}
+
+  /// Push one message, dropping the oldest queued message when the channel is full. Thread-safe.
+  void Push(const T& value) {
+    std::coroutine_handle<> waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        return;
+      }
+      if (queue_.size() == capacity_) {
+        queue_.pop_front();
+        drop_count_++;
+      }
+      queue_.push_back(value);
+      waiter = std::exchange(waiter_, nullptr);
+    }
+    if (waiter) {
+      waiter.resume();
+    }
+  }
+
+  /// Close the channel: pending and future Next() awaits complete with std::nullopt.
+  void Close() {
+    std::coroutine_handle<> waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      waiter = std::exchange(waiter_, nullptr);
+    }
+    if (waiter) {
+      waiter.resume();
+    }
+  }
+
+  /// Number of messages dropped to keep the queue bounded.
+  uint64_t DropCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return drop_count_;
+  }
+
+  /// Awaitable fetching the next message; co_await yields std::optional<T>.
+  auto Next() { return NextAwaiter{*this}; }
+
+ private:
+  struct NextAwaiter {
+    MessageChannel& channel;
+
+    bool await_ready() {
+      std::lock_guard<std::mutex> lock(channel.mutex_);
+      return !channel.queue_.empty() || channel.closed_;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+      std::lock_guard<std::mutex> lock(channel.mutex_);
+      if (!channel.queue_.empty() || channel.closed_) {
+        return false;  // A message raced in between await_ready and here, resume immediately.
+      }
+      assert(channel.waiter_ == nullptr && "MessageChannel is single-consumer: only one coroutine may await Next() at a time");
+      channel.waiter_ = handle;
+      return true;
+    }
+
+    std::optional<T> await_resume() {
+      std::lock_guard<std::mutex> lock(channel.mutex_);
+      if (channel.queue_.empty()) {
+        return std::nullopt;
+      }
+      std::optional<T> value(std::move(channel.queue_.front()));
+      channel.queue_.pop_front();
+      return value;
+    }
+  };
+
+  mutable std::mutex mutex_;
+  std::deque<T> queue_;
+  size_t capacity_;
+  std::coroutine_handle<> waiter_;
+  bool closed_ = false;
+  uint64_t drop_count_ = 0;
+};
+
+}  // namespace magic::z1::awaitable
@@ -0,0 +1,319 @@
+#pragma once
+
+#include "magic_type.h"
+
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__)
+  #include <immintrin.h>
+#elif defined(__aarch64__)
+  #include <arm_neon.h>
+#endif
+
+namespace magic::z1::image_ops {
+
+/**
+ * @brief Non-owning view of an image inside a larger buffer
+ *
+ * Used for zero-copy access to sub-images (e.g. one eye of a stitched binocular frame):
+ * `data` points into the original buffer and row n starts at data + n * step.
+ */
+struct ImageView {
+  const uint8_t* data = nullptr;  ///< First pixel of the view, borrowed from the underlying frame
+  int32_t width = 0;              ///< View width (pixels)
+  int32_t height = 0;             ///< View height (pixels)
+  int32_t step = 0;               ///< Bytes between the starts of consecutive rows in the underlying buffer
+  int32_t bytes_per_pixel = 0;    ///< Bytes per pixel
+};
+
+namespace detail {
+
+// Checks that the image declares a sane row stride and actually owns step * height bytes.
+inline bool ValidateLayout(const Image& image, int32_t bytes_per_pixel) {
+  return image.width > 0 && image.height > 0 &&
+         image.step >= image.width * bytes_per_pixel &&
+         image.data.size() >= static_cast<size_t>(image.step) * image.height;
+}
+
+// Swaps byte 0 and 2 of each 3-byte pixel in a run of `pixel_count` contiguous pixels.
+inline void SwapRedBlueRun(uint8_t* data, size_t pixel_count) {
+  size_t ii = 0;
+
+#if defined(__x86_64__) && defined(__SSSE3__)
+  // 16 pixels = 48 bytes per iteration, three shuffles swapping byte 0 and 2 of each pixel
+  const __m128i mask0 = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+  for (; ii + 16 <= pixel_count; ii += 16) {
+    uint8_t* p = data + ii * 3;
+    // Process 48 bytes as 3 overlapping 15-pixel-aligned groups of 5 whole pixels each
+    for (int block = 0; block < 3; block++) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + block * 15));
+      v = _mm_shuffle_epi8(v, mask0);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p + block * 15), v);
+    }
+    // The three 15-byte groups cover pixels 0..14; pixel 15 is handled scalar
+    uint8_t* last = p + 45;
+    uint8_t tmp = last[0];
+    last[0] = last[2];
+    last[2] = tmp;
+  }
+#elif defined(__aarch64__)
+  for (; ii + 16 <= pixel_count; ii += 16) {
+    uint8x16x3_t pixels = vld3q_u8(data + ii * 3);
+    uint8x16_t red = pixels.val[0];
+    pixels.val[0] = pixels.val[2];
+    pixels.val[2] = red;
+    vst3q_u8(data + ii * 3, pixels);
+  }
+#endif
+
+  for (; ii < pixel_count; ii++) {
+    uint8_t* pixel = data + ii * 3;
+    uint8_t tmp = pixel[0];
+    pixel[0] = pixel[2];
+    pixel[2] = tmp;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Swap the red and blue channels of an "rgb8"/"bgr8" image in place
+ *
+ * Converts between the two 3-byte channel orders without touching the buffer size, so it can
+ * run directly on pooled delivery buffers. Row padding beyond Image::step's pixel data is left
+ * untouched. Vectorized with SSSE3 on x86_64 (16 pixels per iteration) and NEON on aarch64.
+ * Updates Image::encoding accordingly.
+ *
+ * @return true on success, false on unsupported encoding or a buffer smaller than step * height.
+ */
+inline bool SwapRedBlueInPlace(Image& image) {
+  if ((image.encoding != "rgb8" && image.encoding != "bgr8") || !detail::ValidateLayout(image, 3)) {
+    return false;
+  }
+
+  if (image.step == image.width * 3) {
+    detail::SwapRedBlueRun(image.data.data(), static_cast<size_t>(image.width) * image.height);
+  } else {
+    for (int32_t y = 0; y < image.height; y++) {
+      detail::SwapRedBlueRun(image.data.data() + static_cast<size_t>(y) * image.step, image.width);
+    }
+  }
+
+  image.encoding = (image.encoding == "rgb8") ? "bgr8" : "rgb8";
+  return true;
+}
+
+/**
+ * @brief Convert an "rgb8"/"bgr8" image to "mono8" grayscale
+ *
+ * Uses the fixed-point BT.601 weights (77, 150, 29)/256. Source row padding (step beyond
+ * width * 3) is skipped; the destination is written row-compact with step == width. The
+ * destination reuses its buffer when already sized, so repeated conversion on pooled frames
+ * does not allocate.
+ *
+ * @return true on success, false on unsupported encoding or a buffer smaller than step * height.
+ */
+inline bool ConvertToGray(const Image& src, Image& dst) {
+  int red_index;
+  if (src.encoding == "rgb8") {
+    red_index = 0;
+  } else if (src.encoding == "bgr8") {
+    red_index = 2;
+  } else {
+    return false;
+  }
+  if (!detail::ValidateLayout(src, 3)) {
+    return false;
+  }
+
+  dst.header = src.header;
+  dst.width = src.width;
+  dst.height = src.height;
+  dst.encoding = "mono8";
+  dst.is_bigendian = src.is_bigendian;
+  dst.step = src.width;
+  dst.data.resize(static_cast<size_t>(src.width) * src.height);
+
+  size_t row_pixels = static_cast<size_t>(src.width);
+  for (int32_t y = 0; y < src.height; y++) {
+    const uint8_t* in = src.data.data() + static_cast<size_t>(y) * src.step;
+    uint8_t* out = dst.data.data() + static_cast<size_t>(y) * src.width;
+    size_t ii = 0;
+
+#if defined(__aarch64__)
+    const uint8x8_t w_r = vdup_n_u8(77);
+    const uint8x8_t w_g = vdup_n_u8(150);
+    const uint8x8_t w_b = vdup_n_u8(29);
+    for (; ii + 8 <= row_pixels; ii += 8) {
+      uint8x8x3_t pixels = vld3_u8(in + ii * 3);
+      uint16x8_t acc = vmull_u8(pixels.val[red_index], w_r);
+      acc = vmlal_u8(acc, pixels.val[1], w_g);
+      acc = vmlal_u8(acc, pixels.val[2 - red_index], w_b);
+      vst1_u8(out + ii, vshrn_n_u16(acc, 8));
+    }
+#endif
+
+    for (; ii < row_pixels; ii++) {
+      const uint8_t* pixel = in + ii * 3;
+      out[ii] = static_cast<uint8_t>((77 * pixel[red_index] + 150 * pixel[1] + 29 * pixel[2 - red_index]) >> 8);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Convert a 16-bit depth image to meters
+ *
+ * Multiplies each sample by `scale` (default: millimeters to meters). Vectorized with SSE2
+ * on x86_64 and NEON on aarch64.
+ *
+ * Source row padding (step beyond width * 2) is skipped; the output is row-compact.
+ *
+ * @param src Depth image with little-endian uint16 samples (e.g. encoding "16UC1" or "mono16").
+ * @param meters Output buffer with room for width * height floats.
+ * @param scale Meters per depth unit.
+ * @return Number of samples converted, 0 on unsupported encoding or a buffer smaller than step * height.
+ */
+inline size_t DepthToMeters(const Image& src, float* meters, float scale = 0.001f) {
+  if (src.is_bigendian || (src.encoding != "16UC1" && src.encoding != "mono16") ||
+      !detail::ValidateLayout(src, 2)) {
+    return 0;
+  }
+
+  size_t row_samples = static_cast<size_t>(src.width);
+  for (int32_t y = 0; y < src.height; y++) {
+    const uint8_t* in = src.data.data() + static_cast<size_t>(y) * src.step;
+    float* out = meters + static_cast<size_t>(y) * src.width;
+    size_t ii = 0;
+
+#if defined(__x86_64__)
+    const __m128 scale4 = _mm_set1_ps(scale);
+    const __m128i zero = _mm_setzero_si128();
+    for (; ii + 8 <= row_samples; ii += 8) {
+      __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + ii * 2));
+      __m128i lo = _mm_unpacklo_epi16(raw, zero);
+      __m128i hi = _mm_unpackhi_epi16(raw, zero);
+      _mm_storeu_ps(out + ii, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale4));
+      _mm_storeu_ps(out + ii + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale4));
+    }
+#elif defined(__aarch64__)
+    const float32x4_t scale4 = vdupq_n_f32(scale);
+    for (; ii + 8 <= row_samples; ii += 8) {
+      uint16x8_t raw = vld1q_u16(reinterpret_cast<const uint16_t*>(in + ii * 2));
+      uint32x4_t lo = vmovl_u16(vget_low_u16(raw));
+      uint32x4_t hi = vmovl_u16(vget_high_u16(raw));
+      vst1q_f32(out + ii, vmulq_f32(vcvtq_f32_u32(lo), scale4));
+      vst1q_f32(out + ii + 4, vmulq_f32(vcvtq_f32_u32(hi), scale4));
+    }
+#endif
+
+    for (; ii < row_samples; ii++) {
+      uint16_t value = 0;
+      std::memcpy(&value, in + ii * 2, sizeof(value));
+      out[ii] = static_cast<float>(value) * scale;
+    }
+  }
+  return static_cast<size_t>(src.width) * src.height;
+}
+
+/**
+ * @brief Area-average downscale of an "rgb8"/"bgr8"/"mono8" image
+ *
+ * When the source dimensions are integer multiples of the destination dimensions each output
+ * pixel is the box average of its source block; otherwise nearest-neighbor sampling is used.
+ * The destination reuses its buffer when already sized.
+ *
+ * @return true on success, false on unsupported encoding, non-positive destination size or a
+ *         buffer smaller than step * height.
+ */
+inline bool ResizeArea(const Image& src, Image& dst, int32_t dst_width, int32_t dst_height) {
+  int32_t channels;
+  if (src.encoding == "rgb8" || src.encoding == "bgr8") {
+    channels = 3;
+  } else if (src.encoding == "mono8") {
+    channels = 1;
+  } else {
+    return false;
+  }
+  if (dst_width <= 0 || dst_height <= 0 || !detail::ValidateLayout(src, channels)) {
+    return false;
+  }
+
+  dst.header = src.header;
+  dst.width = dst_width;
+  dst.height = dst_height;
+  dst.encoding = src.encoding;
+  dst.is_bigendian = src.is_bigendian;
+  dst.step = dst_width * channels;
+  dst.data.resize(static_cast<size_t>(dst_width) * dst_height * channels);
+
+  const uint8_t* in = src.data.data();
+  uint8_t* out = dst.data.data();
+
+  if (src.width % dst_width == 0 && src.height % dst_height == 0) {
+    int32_t block_w = src.width / dst_width;
+    int32_t block_h = src.height / dst_height;
+    uint32_t block_area = static_cast<uint32_t>(block_w) * block_h;
+    for (int32_t y = 0; y < dst_height; y++) {
+      for (int32_t x = 0; x < dst_width; x++) {
+        for (int32_t c = 0; c < channels; c++) {
+          uint32_t sum = 0;
+          for (int32_t by = 0; by < block_h; by++) {
+            const uint8_t* row = in + (static_cast<size_t>(y) * block_h + by) * src.step + static_cast<size_t>(x) * block_w * channels + c;
+            for (int32_t bx = 0; bx < block_w; bx++) {
+              sum += row[bx * channels];
+            }
+          }
+          out[(static_cast<size_t>(y) * dst_width + x) * channels + c] = static_cast<uint8_t>(sum / block_area);
+        }
+      }
+    }
+  } else {
+    for (int32_t y = 0; y < dst_height; y++) {
+      int32_t sy = static_cast<int32_t>((static_cast<int64_t>(y) * src.height) / dst_height);
+      for (int32_t x = 0; x < dst_width; x++) {
+        int32_t sx = static_cast<int32_t>((static_cast<int64_t>(x) * src.width) / dst_width);
+        std::memcpy(out + (static_cast<size_t>(y) * dst_width + x) * channels, in + static_cast<size_t>(sy) * src.step + static_cast<size_t>(sx) * channels, channels);
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Split a stitched binocular frame into left/right eye views without copying
+ *
+ * The stitched layout places the left eye in the left half of each row and the right eye in
+ * the right half. The returned views alias the frame's buffer (step spans the full stitched
+ * row), so they are only valid while the frame is alive.
+ *
+ * @param frame Stitched frame; BinocularCameraFrame carries no dimensions, so they are passed in.
+ * @param width Stitched image width (pixels, both eyes together).
+ * @param height Stitched image height (pixels).
+ * @param bytes_per_pixel Bytes per pixel of the stitched data.
+ * @param left Output view of the left eye (width / 2 pixels wide).
+ * @param right Output view of the right eye.
+ * @return true on success, false if the buffer size does not match the given dimensions.
+ */
+inline bool SplitBinocularFrame(const BinocularCameraFrame& frame, int32_t width, int32_t height, int32_t bytes_per_pixel, ImageView& left, ImageView& right) {
+  if (width <= 0 || height <= 0 || bytes_per_pixel <= 0 || width % 2 != 0 ||
+      frame.data.size() != static_cast<size_t>(width) * height * bytes_per_pixel) {
+    return false;
+  }
+
+  int32_t full_step = width * bytes_per_pixel;
+  int32_t eye_width = width / 2;
+
+  left.data = frame.data.data();
+  left.width = eye_width;
+  left.height = height;
+  left.step = full_step;
+  left.bytes_per_pixel = bytes_per_pixel;
+
+  right = left;
+  right.data = frame.data.data() + static_cast<size_t>(eye_width) * bytes_per_pixel;
+  return true;
+}
+
+}  // namespace magic::z1::image_ops
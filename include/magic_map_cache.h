@@ -0,0 +1,266 @@
+#pragma once
+
+#include "magic_type.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+namespace magic::z1::slam {
+
+/**
+ * @brief Memory-mapped view of a cached map image
+ *
+ * Returned by MapImageCache::Get. The pixel data is served directly from the page cache via
+ * mmap, so no copy or decompression happens on a cache hit; `pixels` stays valid until the
+ * view is released or destroyed.
+ */
+class MappedMapImage {
+ public:
+  MappedMapImage() = default;
+  MappedMapImage(const MappedMapImage&) = delete;
+  MappedMapImage& operator=(const MappedMapImage&) = delete;
+
+  MappedMapImage(MappedMapImage&& other)
+      : type(std::move(other.type)),
+        width(other.width),
+        height(other.height),
+        max_gray_value(other.max_gray_value),
+        pixels(other.pixels),
+        pixels_size(other.pixels_size),
+        map_base_(other.map_base_),
+        map_size_(other.map_size_) {
+    other.pixels = nullptr;
+    other.pixels_size = 0;
+    other.map_base_ = nullptr;
+    other.map_size_ = 0;
+  }
+
+  MappedMapImage& operator=(MappedMapImage&& other) {
+    if (this != &other) {
+      Release();
+      type = std::move(other.type);
+      width = other.width;
+      height = other.height;
+      max_gray_value = other.max_gray_value;
+      pixels = other.pixels;
+      pixels_size = other.pixels_size;
+      map_base_ = other.map_base_;
+      map_size_ = other.map_size_;
+      other.pixels = nullptr;
+      other.pixels_size = 0;
+      other.map_base_ = nullptr;
+      other.map_size_ = 0;
+    }
+    return *this;
+  }
+
+  /// Destructor, unmaps the cached file if still held.
+  ~MappedMapImage() { Release(); }
+
+  /// Unmap the cached file. After this call `pixels` is no longer valid.
+  void Release() {
+    if (map_base_ != nullptr) {
+      munmap(map_base_, map_size_);
+      map_base_ = nullptr;
+      map_size_ = 0;
+    }
+    pixels = nullptr;
+    pixels_size = 0;
+  }
+
+  std::string type;             ///< Magic number of the image format, "P5": binary PGM
+  uint32_t width = 0;           ///< Image width
+  uint32_t height = 0;          ///< Image height
+  uint32_t max_gray_value = 0;  ///< Max gray value, 255
+
+  const uint8_t* pixels = nullptr;  ///< Mapped image data, read-only
+  size_t pixels_size = 0;           ///< Number of mapped image bytes
+
+ private:
+  friend class MapImageCache;
+
+  void* map_base_ = nullptr;
+  size_t map_size_ = 0;
+};
+
+/**
+ * @brief Persistent on-disk cache of map images, served via mmap
+ *
+ * Avoids re-streaming MapImageData for maps the host has already fetched: store a fetched map
+ * once with Put, and repeat loads complete in milliseconds through Get, which memory-maps the
+ * cached file instead of copying it. Freshness is the caller's contract: validate the map
+ * against the robot (e.g. the map date from SlamNavController::GetMapPath) and Put again when
+ * it changed.
+ *
+ * Cache files are written atomically (temp file + rename), so a crashed writer never leaves a
+ * truncated entry behind.
+ */
+class MapImageCache {
+  // On-disk layout: kFileMagic, then width/height/max_gray_value/type length as uint32,
+  // the type string, a uint64 pixel byte count, and the raw pixels.
+  static constexpr char kFileMagic[8] = {'M', 'Z', '1', 'M', 'A', 'P', '0', '1'};
+
+ public:
+  /**
+   * @brief Constructor, creates the cache directory if it does not exist.
+   * @param cache_dir Local directory holding the cached map files.
+   */
+  explicit MapImageCache(std::string cache_dir)
+      : cache_dir_(std::move(cache_dir)) {
+    mkdir(cache_dir_.c_str(), 0755);
+  }
+
+  /**
+   * @brief Whether a map is present in the cache.
+   * @param map_name Map name.
+   */
+  bool Contains(const std::string& map_name) const {
+    struct stat info {};
+    return ValidName(map_name) && stat(PathFor(map_name).c_str(), &info) == 0;
+  }
+
+  /**
+   * @brief Store a map image in the cache, replacing any previous entry.
+   * @param map_name Map name.
+   * @param image Image data as fetched from the robot.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status Put(const std::string& map_name, const MapImageData& image) {
+    if (!ValidName(map_name)) {
+      return {ErrorCode::INTERNAL_ERROR, "invalid map name"};
+    }
+
+    std::string final_path = PathFor(map_name);
+    std::string temp_path = final_path + ".tmp";
+    int fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      return {ErrorCode::INTERNAL_ERROR, "failed to create cache file"};
+    }
+
+    uint32_t header[4] = {image.width, image.height, image.max_gray_value, static_cast<uint32_t>(image.type.size())};
+    uint64_t pixels_size = image.image.size();
+    bool ok = WriteAll(fd, kFileMagic, sizeof(kFileMagic)) &&
+              WriteAll(fd, header, sizeof(header)) &&
+              WriteAll(fd, image.type.data(), image.type.size()) &&
+              WriteAll(fd, &pixels_size, sizeof(pixels_size)) &&
+              WriteAll(fd, image.image.data(), image.image.size());
+    close(fd);
+    if (!ok || rename(temp_path.c_str(), final_path.c_str()) != 0) {
+      unlink(temp_path.c_str());
+      return {ErrorCode::INTERNAL_ERROR, "failed to write cache file"};
+    }
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Serve a cached map image via mmap.
+   * @param map_name Map name.
+   * @param image Output view; valid until released or destroyed.
+   * @return Operation status, returns Status::OK on a cache hit.
+   */
+  Status Get(const std::string& map_name, MappedMapImage& image) const {
+    if (!ValidName(map_name)) {
+      return {ErrorCode::INTERNAL_ERROR, "invalid map name"};
+    }
+
+    int fd = open(PathFor(map_name).c_str(), O_RDONLY);
+    if (fd < 0) {
+      return {ErrorCode::INTERNAL_ERROR, "map not cached"};
+    }
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(kFileMagic) + 4 * sizeof(uint32_t) + sizeof(uint64_t)) {
+      close(fd);
+      return {ErrorCode::INTERNAL_ERROR, "corrupt cache file"};
+    }
+
+    size_t map_size = static_cast<size_t>(info.st_size);
+    void* base = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+      return {ErrorCode::INTERNAL_ERROR, "mmap failed"};
+    }
+
+    const uint8_t* cursor = static_cast<const uint8_t*>(base);
+    if (std::memcmp(cursor, kFileMagic, sizeof(kFileMagic)) != 0) {
+      munmap(base, map_size);
+      return {ErrorCode::INTERNAL_ERROR, "corrupt cache file"};
+    }
+    cursor += sizeof(kFileMagic);
+
+    uint32_t header[4];
+    std::memcpy(header, cursor, sizeof(header));
+    cursor += sizeof(header);
+
+    uint32_t type_len = header[3];
+    if (sizeof(kFileMagic) + sizeof(header) + type_len + sizeof(uint64_t) > map_size) {
+      munmap(base, map_size);
+      return {ErrorCode::INTERNAL_ERROR, "corrupt cache file"};
+    }
+    std::string type(reinterpret_cast<const char*>(cursor), type_len);
+    cursor += type_len;
+
+    uint64_t pixels_size = 0;
+    std::memcpy(&pixels_size, cursor, sizeof(pixels_size));
+    cursor += sizeof(pixels_size);
+    if (static_cast<size_t>(cursor - static_cast<const uint8_t*>(base)) + pixels_size > map_size) {
+      munmap(base, map_size);
+      return {ErrorCode::INTERNAL_ERROR, "corrupt cache file"};
+    }
+
+    image.Release();
+    image.type = std::move(type);
+    image.width = header[0];
+    image.height = header[1];
+    image.max_gray_value = header[2];
+    image.pixels = cursor;
+    image.pixels_size = static_cast<size_t>(pixels_size);
+    image.map_base_ = base;
+    image.map_size_ = map_size;
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Remove one map from the cache.
+   * @param map_name Map name.
+   * @return Operation status, returns Status::OK on success (also when the map was not cached).
+   */
+  Status Remove(const std::string& map_name) {
+    if (!ValidName(map_name)) {
+      return {ErrorCode::INTERNAL_ERROR, "invalid map name"};
+    }
+    unlink(PathFor(map_name).c_str());
+    return {ErrorCode::OK, ""};
+  }
+
+ private:
+  // Map names become file names; path separators and empty names are rejected.
+  static bool ValidName(const std::string& map_name) {
+    return !map_name.empty() && map_name.find('/') == std::string::npos && map_name != "." && map_name != "..";
+  }
+
+  static bool WriteAll(int fd, const void* data, size_t size) {
+    const uint8_t* cursor = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+      ssize_t written = write(fd, cursor, size);
+      if (written <= 0) {
+        return false;
+      }
+      cursor += written;
+      size -= static_cast<size_t>(written);
+    }
+    return true;
+  }
+
+  std::string PathFor(const std::string& map_name) const {
+    return cache_dir_ + "/" + map_name + ".mz1map";
+  }
+
+  std::string cache_dir_;
+};
+
+}  // namespace magic::z1::slam
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -82,6 +83,15 @@ class MAGIC_EXPORT_API HighLevelMotionController final : public MotionController
    */
   Status SetGait(const GaitMode gait_mode, int timeout_ms = 10000);
 
+  /**
+   * @brief Asynchronous variant of SetGait, returns immediately.
+   * @param gait_mode Enumeration type gait mode.
+   * @param timeout_ms Timeout time in milliseconds.
+   * @return Future resolving to the execution status once the gait switch completes or times out.
+   * @note In-flight requests are pipelined on the existing connection, no thread is spawned per call.
+   */
+  std::future<Status> SetGaitAsync(const GaitMode gait_mode, int timeout_ms = 10000);
+
   /**
    * @brief Get the robot's gait mode (e.g., standing lock, balanced standing, humanoid walking, etc., refer to GaitMode definition).
    * @param gait_mode Enumeration type gait mode.
@@ -98,6 +108,14 @@ class MAGIC_EXPORT_API HighLevelMotionController final : public MotionController
    */
   Status ExecuteTrick(const TrickAction trick_action, int timeout_ms = 10000);
 
+  /**
+   * @brief Asynchronous variant of ExecuteTrick, returns immediately.
+   * @param trick_action Trick action identifier.
+   * @param timeout_ms Timeout time in milliseconds.
+   * @return Future resolving to the execution status once the trick completes or times out.
+   */
+  std::future<Status> ExecuteTrickAsync(const TrickAction trick_action, int timeout_ms = 10000);
+
   /**
    * @brief Send real-time joystick control commands. Recommended sending frequency is 20Hz.
    * @param joy_command Control command containing left and right joystick coordinates.
@@ -112,6 +130,14 @@ class MAGIC_EXPORT_API HighLevelMotionController final : public MotionController
    * @return Execution status.
    */
   Status HeadMove(float shake_angle, int timeout_ms = 5000);
+
+  /**
+   * @brief Asynchronous variant of HeadMove, returns immediately.
+   * @param shake_angle Shake angle in rad, direction: left: negative, right: positive, unit: rad, range: [-0.698, 0.698]
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the execution status once the head move completes or times out.
+   */
+  std::future<Status> HeadMoveAsync(float shake_angle, int timeout_ms = 5000);
 };
 
 /**
@@ -136,6 +162,14 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
   using BodyImuCallback = std::function<void(const ImuPtr)>;                    // Body IMU data callback
   using EstimatorStateCallback = std::function<void(const EstimatorStatePtr)>;  // Estimator state data callback
 
+  // Callback function type definitions for fixed-capacity joint data (no per-message allocation,
+  // the referenced object is reused by the SDK and only valid during the callback)
+  using ArmJointStateFixedCallback = std::function<void(const JointStateFixed<kArmJointNum>&)>;      // Arm fixed joint state callback
+  using LegJointStateFixedCallback = std::function<void(const JointStateFixed<kLegJointNum>&)>;      // Leg fixed joint state callback
+  using HeadJointStateFixedCallback = std::function<void(const JointStateFixed<kHeadJointNum>&)>;    // Head fixed joint state callback
+  using WaistJointStateFixedCallback = std::function<void(const JointStateFixed<kWaistJointNum>&)>;  // Waist fixed joint state callback
+  using HandStateFixedCallback = std::function<void(const HandStateFixed&)>;                         // Hand fixed state callback
+
  public:
   /// Constructor, initializes low-level controller.
   LowLevelMotionController();
@@ -154,6 +188,15 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   virtual void Shutdown() override;
 
+  /**
+   * @brief Set the quality-of-service of a topic's subscription queue
+   * @param topic Topic to configure
+   * @param qos Queue depth and drop policy; a depth of 1 gives keep-last semantics, which is
+   *        the right choice for joint state and IMU topics feeding a control loop
+   * @return Execution status.
+   */
+  Status SetSubscriptionQos(LowLevelDataTopic topic, const TopicQos& qos);
+
   // === Arm Control ===
 
   /**
@@ -174,6 +217,20 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   Status PublishArmCommand(const JointCommand& command);
 
+  /**
+   * @brief Publish arm joint control command from a fixed-capacity command (no heap allocation)
+   * @param command Arm joint control command with compile-time joint count
+   * @return Execution status.
+   */
+  Status PublishArmCommand(const JointCommandFixed<kArmJointNum>& command);
+
+  /**
+   * @brief Subscribe to arm joint state data through a fixed-capacity state object
+   * @param callback Callback invoked with a reused JointStateFixed, valid only during the callback
+   * @note Unsubscribed together with the regular subscription via UnsubscribeArmState().
+   */
+  void SubscribeArmStateFixed(ArmJointStateFixedCallback callback);
+
   // === Leg Control ===
 
   /**
@@ -194,6 +251,20 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   Status PublishLegCommand(const JointCommand& command);
 
+  /**
+   * @brief Publish leg joint control command from a fixed-capacity command (no heap allocation)
+   * @param command Leg joint control command with compile-time joint count
+   * @return Execution status.
+   */
+  Status PublishLegCommand(const JointCommandFixed<kLegJointNum>& command);
+
+  /**
+   * @brief Subscribe to leg joint state data through a fixed-capacity state object
+   * @param callback Callback invoked with a reused JointStateFixed, valid only during the callback
+   * @note Unsubscribed together with the regular subscription via UnsubscribeLegState().
+   */
+  void SubscribeLegStateFixed(LegJointStateFixedCallback callback);
+
   // === Head Control ===
 
   /**
@@ -214,6 +285,20 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   Status PublishHeadCommand(const JointCommand& command);
 
+  /**
+   * @brief Publish head joint control command from a fixed-capacity command (no heap allocation)
+   * @param command Head joint control command with compile-time joint count
+   * @return Execution status.
+   */
+  Status PublishHeadCommand(const JointCommandFixed<kHeadJointNum>& command);
+
+  /**
+   * @brief Subscribe to head joint state data through a fixed-capacity state object
+   * @param callback Callback invoked with a reused JointStateFixed, valid only during the callback
+   * @note Unsubscribed together with the regular subscription via UnsubscribeHeadState().
+   */
+  void SubscribeHeadStateFixed(HeadJointStateFixedCallback callback);
+
   // === Waist Control ===
 
   /**
@@ -234,6 +319,32 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   Status PublishWaistCommand(const JointCommand& command);
 
+  /**
+   * @brief Publish waist joint control command from a fixed-capacity command (no heap allocation)
+   * @param command Waist joint control command with compile-time joint count
+   * @return Execution status.
+   */
+  Status PublishWaistCommand(const JointCommandFixed<kWaistJointNum>& command);
+
+  /**
+   * @brief Subscribe to waist joint state data through a fixed-capacity state object
+   * @param callback Callback invoked with a reused JointStateFixed, valid only during the callback
+   * @note Unsubscribed together with the regular subscription via UnsubscribeWaistState().
+   */
+  void SubscribeWaistStateFixed(WaistJointStateFixedCallback callback);
+
+  // === Whole Body Control ===
+
+  /**
+   * @brief Publish control commands for all body joints as a single wire message
+   * @param command Aggregate command covering arm, leg, head and waist joints
+   * @return Execution status.
+   * @note Equivalent to calling PublishArmCommand, PublishLegCommand, PublishHeadCommand and
+   *       PublishWaistCommand in one cycle, but pays serialization and transport cost once and
+   *       guarantees the controller applies all parts in the same control cycle.
+   */
+  Status PublishWholeBodyCommand(const WholeBodyJointCommand& command);
+
   // === Hand Control ===
 
   /**
@@ -254,6 +365,20 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    */
   Status PublishHandCommand(const HandCommand& command);
 
+  /**
+   * @brief Publish hand control command from a fixed-capacity command (no heap allocation)
+   * @param command Hand control command with compile-time joint count
+   * @return Execution status.
+   */
+  Status PublishHandCommand(const HandCommandFixed& command);
+
+  /**
+   * @brief Subscribe to hand state data through a fixed-capacity state object
+   * @param callback Callback invoked with a reused HandStateFixed, valid only during the callback
+   * @note Unsubscribed together with the regular subscription via UnsubscribeHandState().
+   */
+  void SubscribeHandStateFixed(HandStateFixedCallback callback);
+
   /**
    * @brief Subscribe to body IMU data
    * @param callback Processing callback after receiving IMU data
@@ -275,6 +400,75 @@ class MAGIC_EXPORT_API LowLevelMotionController final : public MotionControllerB
    * @brief Unsubscribe from estimator state data
    */
   void UnsubscribeEstimatorState();
+
+  // === Poll-Mode State Access ===
+  //
+  // Wait-free alternative to the callback subscriptions for real-time loops. Each topic is
+  // backed by a latest-value slot (seqlock) written by the SDK's receive thread; polling reads
+  // the newest sample without locks, wake-ups or running user code on SDK threads. The slots
+  // are armed as soon as the controller is initialized, no Subscribe* call is required.
+
+  /**
+   * @brief Fetch the newest arm joint state
+   * @param state Output state, only written when a new sample is available. The vector's capacity
+   *        is reused across calls, so polling with the same object does not allocate after the first call.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollArmState(JointState& state);
+
+  /// Fixed-capacity overload of PollArmState, never allocates.
+  bool PollArmState(JointStateFixed<kArmJointNum>& state);
+
+  /**
+   * @brief Fetch the newest leg joint state
+   * @param state Output state, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollLegState(JointState& state);
+
+  /// Fixed-capacity overload of PollLegState, never allocates.
+  bool PollLegState(JointStateFixed<kLegJointNum>& state);
+
+  /**
+   * @brief Fetch the newest head joint state
+   * @param state Output state, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollHeadState(JointState& state);
+
+  /// Fixed-capacity overload of PollHeadState, never allocates.
+  bool PollHeadState(JointStateFixed<kHeadJointNum>& state);
+
+  /**
+   * @brief Fetch the newest waist joint state
+   * @param state Output state, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollWaistState(JointState& state);
+
+  /// Fixed-capacity overload of PollWaistState, never allocates.
+  bool PollWaistState(JointStateFixed<kWaistJointNum>& state);
+
+  /**
+   * @brief Fetch the newest hand state
+   * @param state Output state, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollHandState(HandStateFixed& state);
+
+  /**
+   * @brief Fetch the newest body IMU sample
+   * @param imu Output sample, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollBodyImu(Imu& imu);
+
+  /**
+   * @brief Fetch the newest estimator state
+   * @param state Output state, only written when a new sample is available.
+   * @return true when a sample newer than the one previously returned to this caller was available.
+   */
+  bool PollEstimatorState(EstimatorState& state);
 };
 
 }  // namespace magic::z1::motion
\ No newline at end of file
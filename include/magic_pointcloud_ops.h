@@ -0,0 +1,188 @@
+#pragma once
+
+#include "magic_type.h"
+
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__)
+  #include <immintrin.h>
+#elif defined(__aarch64__)
+  #include <arm_neon.h>
+#endif
+
+namespace magic::z1::pointcloud_ops {
+
+// PointField::datatype constants, matching ROS2 sensor_msgs::msg::PointField
+constexpr int8_t kInt8 = 1;
+constexpr int8_t kUint8 = 2;
+constexpr int8_t kInt16 = 3;
+constexpr int8_t kUint16 = 4;
+constexpr int8_t kInt32 = 5;
+constexpr int8_t kUint32 = 6;
+constexpr int8_t kFloat32 = 7;
+constexpr int8_t kFloat64 = 8;
+
+/**
+ * @brief Find a field descriptor by name
+ * @return Pointer into cloud.fields, or nullptr if the field does not exist
+ */
+inline const PointField* FindField(const PointCloud2& cloud, const std::string& name) {
+  for (const PointField& field : cloud.fields) {
+    if (field.name == name) {
+      return &field;
+    }
+  }
+  return nullptr;
+}
+
+namespace detail {
+
+// Deinterleaves float32 x/y/z at the given offsets into structure-of-arrays planes.
+// Vectorized for the common packed layouts; generic strides fall back to scalar loads.
+inline void DeinterleaveXYZ(const uint8_t* data, size_t count, int32_t point_step, int32_t x_off, int32_t y_off, int32_t z_off, float* x_out, float* y_out, float* z_out) {
+  size_t ii = 0;
+
+  if (x_off == 0 && y_off == 4 && z_off == 8 && point_step == 16) {
+#if defined(__x86_64__)
+    // 4 points per iteration: load 4 rows of (x y z w) and transpose to planes
+    for (; ii + 4 <= count; ii += 4) {
+      const float* p = reinterpret_cast<const float*>(data + ii * 16);
+      __m128 r0 = _mm_loadu_ps(p + 0);
+      __m128 r1 = _mm_loadu_ps(p + 4);
+      __m128 r2 = _mm_loadu_ps(p + 8);
+      __m128 r3 = _mm_loadu_ps(p + 12);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      _mm_storeu_ps(x_out + ii, r0);
+      _mm_storeu_ps(y_out + ii, r1);
+      _mm_storeu_ps(z_out + ii, r2);
+    }
+#elif defined(__aarch64__)
+    for (; ii + 4 <= count; ii += 4) {
+      float32x4x4_t rows = vld4q_f32(reinterpret_cast<const float*>(data + ii * 16));
+      vst1q_f32(x_out + ii, rows.val[0]);
+      vst1q_f32(y_out + ii, rows.val[1]);
+      vst1q_f32(z_out + ii, rows.val[2]);
+    }
+#endif
+  } else if (x_off == 0 && y_off == 4 && z_off == 8 && point_step == 12) {
+#if defined(__aarch64__)
+    for (; ii + 4 <= count; ii += 4) {
+      float32x4x3_t rows = vld3q_f32(reinterpret_cast<const float*>(data + ii * 12));
+      vst1q_f32(x_out + ii, rows.val[0]);
+      vst1q_f32(y_out + ii, rows.val[1]);
+      vst1q_f32(z_out + ii, rows.val[2]);
+    }
+#endif
+  }
+
+  for (; ii < count; ii++) {
+    const uint8_t* point = data + ii * point_step;
+    std::memcpy(x_out + ii, point + x_off, sizeof(float));
+    std::memcpy(y_out + ii, point + y_off, sizeof(float));
+    std::memcpy(z_out + ii, point + z_off, sizeof(float));
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Extract x/y/z into structure-of-arrays planes
+ *
+ * Output layout: xyz_soa[0..n) holds x, xyz_soa[max_points..) holds y, xyz_soa[2*max_points..)
+ * holds z, directly consumable by SIMD perception kernels. The packed float32 layouts
+ * (point_step 16 or 12, offsets 0/4/8) are deinterleaved with SSE on x86_64 and NEON on
+ * aarch64; other strides use a scalar path.
+ *
+ * @param cloud Source point cloud; x/y/z must be little-endian float32 fields.
+ * @param xyz_soa Output buffer with room for 3 * max_points floats.
+ * @param max_points Capacity of each output plane.
+ * @return Number of points extracted, 0 if the cloud has no float32 x/y/z fields or is big-endian.
+ */
+inline size_t ExtractXYZ(const PointCloud2& cloud, float* xyz_soa, size_t max_points) {
+  const PointField* x_field = FindField(cloud, "x");
+  const PointField* y_field = FindField(cloud, "y");
+  const PointField* z_field = FindField(cloud, "z");
+  if (cloud.is_bigendian || x_field == nullptr || y_field == nullptr || z_field == nullptr ||
+      x_field->datatype != kFloat32 || y_field->datatype != kFloat32 || z_field->datatype != kFloat32 ||
+      cloud.point_step <= 0) {
+    return 0;
+  }
+  // Every field must fit inside the point stride, or the last points read past the buffer
+  constexpr int32_t kFloatSize = static_cast<int32_t>(sizeof(float));
+  if (x_field->offset < 0 || x_field->offset + kFloatSize > cloud.point_step ||
+      y_field->offset < 0 || y_field->offset + kFloatSize > cloud.point_step ||
+      z_field->offset < 0 || z_field->offset + kFloatSize > cloud.point_step) {
+    return 0;
+  }
+
+  size_t count = cloud.data.size() / static_cast<size_t>(cloud.point_step);
+  if (count > max_points) {
+    count = max_points;
+  }
+
+  detail::DeinterleaveXYZ(cloud.data.data(), count, cloud.point_step, x_field->offset, y_field->offset, z_field->offset, xyz_soa, xyz_soa + max_points, xyz_soa + 2 * max_points);
+  return count;
+}
+
+/**
+ * @brief Extract x/y/z planes plus the intensity plane
+ *
+ * Same layout and fast paths as ExtractXYZ; intensity is extracted scalar (it rarely shares
+ * the packed xyz stride) and converted to float from float32 or uint8/uint16 fields.
+ *
+ * @param cloud Source point cloud.
+ * @param xyz_soa Output buffer with room for 3 * max_points floats.
+ * @param intensity Output buffer with room for max_points floats.
+ * @param max_points Capacity of each output plane.
+ * @return Number of points extracted, 0 on unsupported layout.
+ */
+inline size_t ExtractXYZI(const PointCloud2& cloud, float* xyz_soa, float* intensity, size_t max_points) {
+  const PointField* i_field = FindField(cloud, "intensity");
+  if (i_field == nullptr) {
+    return 0;
+  }
+  int32_t intensity_size;
+  switch (i_field->datatype) {
+    case kFloat32:
+      intensity_size = 4;
+      break;
+    case kUint16:
+      intensity_size = 2;
+      break;
+    case kUint8:
+      intensity_size = 1;
+      break;
+    default:
+      return 0;
+  }
+  if (i_field->offset < 0 || i_field->offset + intensity_size > cloud.point_step) {
+    return 0;
+  }
+
+  size_t count = ExtractXYZ(cloud, xyz_soa, max_points);
+  for (size_t ii = 0; ii < count; ii++) {
+    const uint8_t* point = cloud.data.data() + ii * cloud.point_step + i_field->offset;
+    switch (i_field->datatype) {
+      case kFloat32: {
+        std::memcpy(intensity + ii, point, sizeof(float));
+        break;
+      }
+      case kUint8: {
+        intensity[ii] = static_cast<float>(*point);
+        break;
+      }
+      case kUint16: {
+        uint16_t value = 0;
+        std::memcpy(&value, point, sizeof(value));
+        intensity[ii] = static_cast<float>(value);
+        break;
+      }
+      default:
+        return 0;
+    }
+  }
+  return count;
+}
+
+}  // namespace magic::z1::pointcloud_ops
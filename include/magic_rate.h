@@ -0,0 +1,168 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+  #include <sys/timerfd.h>
+  #include <unistd.h>
+#endif
+
+namespace magic::z1 {
+
+/**
+ * @brief Precision cycle pacer for high-rate control loops
+ *
+ * std::this_thread::sleep_until alone wakes 50-200us late on a stock kernel, which a 2ms
+ * control budget cannot absorb. RateDriver paces a loop with a hybrid strategy: it sleeps
+ * until shortly before the deadline and spins the remainder, giving sub-10us cycle jitter
+ * at the cost of one spin window of CPU per cycle.
+ *
+ * Usage in a 500Hz command loop:
+ * @code
+ *   RateDriver rate(500.0);
+ *   while (running) {
+ *     controller.PublishArmCommand(arm_command);
+ *     rate.WaitNextCycle();
+ *   }
+ * @endcode
+ *
+ * Deadlines advance on a fixed grid, so one long cycle does not shift all following cycles.
+ * If the loop falls behind by more than a full period, the grid is resynchronized and the
+ * skipped cycles are counted as misses instead of being replayed as a burst.
+ */
+class RateDriver {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  /**
+   * @brief Constructor.
+   * @param rate_hz Cycle rate (unit: Hz), e.g. 500.0 for a 2ms period.
+   * @param spin_window_us How long before the deadline to switch from sleeping to spinning
+   *        (unit: microseconds). Larger windows lower jitter and burn more CPU; the default
+   *        covers typical scheduler wake-up latency.
+   * @param use_timerfd Back the coarse sleep with a timerfd (Linux only). Useful when the
+   *        loop also multiplexes file descriptors or sleep_until proves too coarse.
+   */
+  explicit RateDriver(double rate_hz, int64_t spin_window_us = 150, bool use_timerfd = false)
+      : period_(std::chrono::nanoseconds(static_cast<int64_t>(1e9 / rate_hz))),
+        spin_window_(std::chrono::microseconds(spin_window_us)) {
+#ifdef __linux__
+    if (use_timerfd) {
+      timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    }
+#else
+    (void)use_timerfd;
+#endif
+    Reset();
+  }
+
+  ~RateDriver() {
+#ifdef __linux__
+    if (timer_fd_ >= 0) {
+      close(timer_fd_);
+    }
+#endif
+  }
+
+  RateDriver(const RateDriver&) = delete;
+  RateDriver& operator=(const RateDriver&) = delete;
+
+  /**
+   * @brief Block until the next cycle deadline.
+   *
+   * Returns as close after the deadline as the hybrid sleep/spin allows and updates the
+   * cycle and miss counters. Call once per loop iteration, after the cycle's work.
+   */
+  void WaitNextCycle() {
+    Clock::time_point deadline = next_deadline_;
+    Clock::time_point now = Clock::now();
+
+    if (now > deadline) {
+      // The loop body overran the budget: resynchronize the grid instead of replaying the
+      // skipped cycles as a burst, counting every overrun grid point as a miss (a stall of
+      // 10 periods shows 10 misses).
+      int64_t lateness_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - deadline).count();
+      if (lateness_ns > max_lateness_ns_) {
+        max_lateness_ns_ = lateness_ns;
+      }
+      while (next_deadline_ <= now) {
+        next_deadline_ += period_;
+        deadline_miss_count_++;
+      }
+      cycle_count_++;
+      return;
+    }
+
+    SleepUntil(deadline - spin_window_);
+    while (Clock::now() < deadline) {
+      CpuRelax();
+    }
+
+    int64_t lateness_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - deadline).count();
+    if (lateness_ns > max_lateness_ns_) {
+      max_lateness_ns_ = lateness_ns;
+    }
+
+    next_deadline_ += period_;
+    cycle_count_++;
+  }
+
+  /// Restart the deadline grid from now and clear all counters.
+  void Reset() {
+    next_deadline_ = Clock::now() + period_;
+    cycle_count_ = 0;
+    deadline_miss_count_ = 0;
+    max_lateness_ns_ = 0;
+  }
+
+  uint64_t CycleCount() const { return cycle_count_; }              ///< Completed cycles since Reset
+  uint64_t DeadlineMissCount() const { return deadline_miss_count_; }  ///< Cycles whose work overran the deadline since Reset
+  int64_t MaxLatenessNs() const { return max_lateness_ns_; }        ///< Worst observed wake-up lateness (unit: nanoseconds)
+
+ private:
+  void SleepUntil(Clock::time_point wake) {
+    if (Clock::now() >= wake) {
+      return;
+    }
+#ifdef __linux__
+    if (timer_fd_ >= 0) {
+      // steady_clock is CLOCK_MONOTONIC on Linux, so the absolute deadline maps directly.
+      int64_t wake_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wake.time_since_epoch()).count();
+      itimerspec spec{};
+      spec.it_value.tv_sec = wake_ns / 1000000000;
+      spec.it_value.tv_nsec = wake_ns % 1000000000;
+      if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) == 0) {
+        uint64_t expirations = 0;
+        ssize_t ret = read(timer_fd_, &expirations, sizeof(expirations));
+        (void)ret;
+        return;
+      }
+    }
+#endif
+    std::this_thread::sleep_until(wake);
+  }
+
+  static void CpuRelax() {
+#if defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  std::chrono::nanoseconds period_;
+  std::chrono::nanoseconds spin_window_;
+  Clock::time_point next_deadline_;
+
+  uint64_t cycle_count_ = 0;
+  uint64_t deadline_miss_count_ = 0;
+  int64_t max_lateness_ns_ = 0;
+
+#ifdef __linux__
+  int timer_fd_ = -1;
+#endif
+};
+
+}  // namespace magic::z1
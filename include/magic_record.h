@@ -0,0 +1,668 @@
+#pragma once
+
+#include "magic_type.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace magic::z1::record {
+
+class TopicRecorder;
+using TopicRecorderPtr = std::unique_ptr<TopicRecorder>;
+
+class TopicPlayer;
+using TopicPlayerPtr = std::unique_ptr<TopicPlayer>;
+
+/**
+ * @brief Options of a topic recording session
+ */
+struct RecordOptions {
+  /**
+   * @brief Path of the log file to create
+   */
+  std::string output_path;
+
+  /**
+   * @brief Topics to record
+   *
+   * Caller-chosen topic names (e.g. "arm_joint_state", "body_imu", "lidar_point_cloud").
+   * An empty list records every topic passed to Record.
+   */
+  std::vector<std::string> topics;
+
+  int32_t flush_interval_ms = 1000;              ///< How often the writer thread flushes buffered records to disk
+  int32_t write_buffer_bytes = 8 * 1024 * 1024;  ///< Capacity of each of the two preallocated write buffers
+};
+
+/**
+ * @brief Counters of a recording session
+ */
+struct RecordStats {
+  uint64_t message_count = 0;  ///< Messages appended to the log
+  uint64_t byte_count = 0;     ///< Serialized bytes appended to the log
+  uint64_t drop_count = 0;     ///< Messages dropped because both write buffers were full
+};
+
+namespace detail {
+
+// Record type tags stored in the log
+enum class RecordType : uint8_t {
+  JOINT_STATE = 1,
+  IMU = 2,
+  POINT_CLOUD = 3,
+  IMAGE = 4,
+  ODOMETRY = 5,
+};
+
+constexpr char kLogMagic[8] = {'M', 'Z', '1', 'L', 'O', 'G', '0', '1'};
+constexpr char kIndexMagic[8] = {'M', 'Z', '1', 'I', 'D', 'X', '0', '1'};
+
+// --- serialization helpers (host byte order and layout; both shipped architectures are
+// --- little-endian LP64, and logs are not an interchange format) ---
+
+template <typename T>
+inline void AppendPod(std::vector<uint8_t>& out, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  const uint8_t* raw = reinterpret_cast<const uint8_t*>(&value);
+  out.insert(out.end(), raw, raw + sizeof(T));
+}
+
+inline void AppendString(std::vector<uint8_t>& out, const std::string& value) {
+  AppendPod(out, static_cast<uint32_t>(value.size()));
+  out.insert(out.end(), value.begin(), value.end());
+}
+
+template <typename T>
+inline void AppendVector(std::vector<uint8_t>& out, const std::vector<T>& values) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  AppendPod(out, static_cast<uint32_t>(values.size()));
+  const uint8_t* raw = reinterpret_cast<const uint8_t*>(values.data());
+  out.insert(out.end(), raw, raw + values.size() * sizeof(T));
+}
+
+// Bounds-checked reader over a serialized payload
+class PayloadReader {
+ public:
+  PayloadReader(const uint8_t* data, size_t size)
+      : data_(data), size_(size) {}
+
+  template <typename T>
+  bool ReadPod(T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (offset_ + sizeof(T) > size_) {
+      return false;
+    }
+    std::memcpy(&value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string& value) {
+    uint32_t length = 0;
+    if (!ReadPod(length) || offset_ + length > size_) {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char*>(data_ + offset_), length);
+    offset_ += length;
+    return true;
+  }
+
+  template <typename T>
+  bool ReadVector(std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    uint32_t count = 0;
+    if (!ReadPod(count) || offset_ + static_cast<size_t>(count) * sizeof(T) > size_) {
+      return false;
+    }
+    values.resize(count);
+    std::memcpy(values.data(), data_ + offset_, static_cast<size_t>(count) * sizeof(T));
+    offset_ += static_cast<size_t>(count) * sizeof(T);
+    return true;
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+inline void Serialize(std::vector<uint8_t>& out, const JointState& msg) {
+  AppendPod(out, msg.timestamp);
+  AppendVector(out, msg.joints);
+}
+
+inline bool Deserialize(PayloadReader& reader, JointState& msg) {
+  return reader.ReadPod(msg.timestamp) && reader.ReadVector(msg.joints);
+}
+
+inline void Serialize(std::vector<uint8_t>& out, const Imu& msg) {
+  AppendPod(out, msg);
+}
+
+inline bool Deserialize(PayloadReader& reader, Imu& msg) {
+  return reader.ReadPod(msg);
+}
+
+inline void Serialize(std::vector<uint8_t>& out, const Header& header) {
+  AppendPod(out, header.stamp);
+  AppendString(out, header.frame_id);
+}
+
+inline bool Deserialize(PayloadReader& reader, Header& header) {
+  return reader.ReadPod(header.stamp) && reader.ReadString(header.frame_id);
+}
+
+inline void Serialize(std::vector<uint8_t>& out, const PointCloud2& msg) {
+  Serialize(out, msg.header);
+  AppendPod(out, msg.height);
+  AppendPod(out, msg.width);
+  AppendPod(out, static_cast<uint32_t>(msg.fields.size()));
+  for (const PointField& field : msg.fields) {
+    AppendString(out, field.name);
+    AppendPod(out, field.offset);
+    AppendPod(out, field.datatype);
+    AppendPod(out, field.count);
+  }
+  AppendPod(out, msg.is_bigendian);
+  AppendPod(out, msg.point_step);
+  AppendPod(out, msg.row_step);
+  AppendVector(out, msg.data);
+  AppendPod(out, msg.is_dense);
+}
+
+inline bool Deserialize(PayloadReader& reader, PointCloud2& msg) {
+  uint32_t field_count = 0;
+  if (!Deserialize(reader, msg.header) || !reader.ReadPod(msg.height) || !reader.ReadPod(msg.width) || !reader.ReadPod(field_count)) {
+    return false;
+  }
+  msg.fields.resize(field_count);
+  for (PointField& field : msg.fields) {
+    if (!reader.ReadString(field.name) || !reader.ReadPod(field.offset) || !reader.ReadPod(field.datatype) || !reader.ReadPod(field.count)) {
+      return false;
+    }
+  }
+  return reader.ReadPod(msg.is_bigendian) && reader.ReadPod(msg.point_step) && reader.ReadPod(msg.row_step) &&
+         reader.ReadVector(msg.data) && reader.ReadPod(msg.is_dense);
+}
+
+inline void Serialize(std::vector<uint8_t>& out, const Image& msg) {
+  Serialize(out, msg.header);
+  AppendPod(out, msg.height);
+  AppendPod(out, msg.width);
+  AppendString(out, msg.encoding);
+  AppendPod(out, msg.is_bigendian);
+  AppendPod(out, msg.step);
+  AppendVector(out, msg.data);
+}
+
+inline bool Deserialize(PayloadReader& reader, Image& msg) {
+  return Deserialize(reader, msg.header) && reader.ReadPod(msg.height) && reader.ReadPod(msg.width) &&
+         reader.ReadString(msg.encoding) && reader.ReadPod(msg.is_bigendian) && reader.ReadPod(msg.step) &&
+         reader.ReadVector(msg.data);
+}
+
+inline void Serialize(std::vector<uint8_t>& out, const Odometry& msg) {
+  Serialize(out, msg.header);
+  AppendString(out, msg.child_frame_id);
+  AppendPod(out, msg.position);
+  AppendPod(out, msg.orientation);
+  AppendPod(out, msg.linear_velocity);
+  AppendPod(out, msg.angular_velocity);
+}
+
+inline bool Deserialize(PayloadReader& reader, Odometry& msg) {
+  return Deserialize(reader, msg.header) && reader.ReadString(msg.child_frame_id) && reader.ReadPod(msg.position) &&
+         reader.ReadPod(msg.orientation) && reader.ReadPod(msg.linear_velocity) && reader.ReadPod(msg.angular_velocity);
+}
+
+}  // namespace detail
+
+/**
+ * @class TopicRecorder
+ * @brief Records topic data to an indexed binary log through an asynchronous writer thread.
+ *
+ * Wire the Record overloads into the subscription callbacks of the topics to capture:
+ * @code
+ *   TopicRecorder recorder;
+ *   recorder.Start({.output_path = "incident.mz1log"});
+ *   controller.SubscribeBodyImu([&](const std::shared_ptr<Imu> msg) { recorder.Record("body_imu", *msg); });
+ * @endcode
+ *
+ * Record serializes into one of two preallocated buffers and returns; the writer thread swaps
+ * buffers and performs all file IO, so the subscription callbacks never block on disk. When
+ * the writer falls behind and both buffers are full, messages are dropped and counted rather
+ * than stalling the callback. A topic directory is appended on Stop so readers can enumerate
+ * contents without scanning.
+ */
+class TopicRecorder : public NonCopyable {
+ public:
+  TopicRecorder() = default;
+
+  /// Destructor, stops recording and finalizes the log.
+  ~TopicRecorder() { Stop(); }
+
+  /**
+   * @brief Start recording to the configured output path.
+   * @param options Recording options: output path, topic filter, flush policy.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status Start(const RecordOptions& options) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+      return {ErrorCode::INTERNAL_ERROR, "already recording"};
+    }
+    file_.open(options.output_path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+      return {ErrorCode::INTERNAL_ERROR, "failed to create log file"};
+    }
+    file_.write(detail::kLogMagic, sizeof(detail::kLogMagic));
+
+    options_ = options;
+    stats_ = RecordStats{};
+    topic_directory_.clear();
+    active_buffer_.clear();
+    active_buffer_.reserve(options.write_buffer_bytes);
+    write_buffer_.clear();
+    write_buffer_.reserve(options.write_buffer_bytes);
+
+    running_ = true;
+    writer_ = std::thread([this] { WriterLoop(); });
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Stop recording, flush buffered records and append the topic directory.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!running_) {
+        return {ErrorCode::OK, ""};
+      }
+      running_ = false;
+    }
+    cv_.notify_one();
+    writer_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    WriteIndex();
+    file_.close();
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Get counters of the current (or last) recording session.
+   */
+  RecordStats GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /// Record one joint state message under the given topic name.
+  void Record(const std::string& topic_name, const JointState& msg) { Append(topic_name, detail::RecordType::JOINT_STATE, msg); }
+
+  /// Record one IMU message under the given topic name.
+  void Record(const std::string& topic_name, const Imu& msg) { Append(topic_name, detail::RecordType::IMU, msg); }
+
+  /// Record one point cloud message under the given topic name.
+  void Record(const std::string& topic_name, const PointCloud2& msg) { Append(topic_name, detail::RecordType::POINT_CLOUD, msg); }
+
+  /// Record one image message under the given topic name.
+  void Record(const std::string& topic_name, const Image& msg) { Append(topic_name, detail::RecordType::IMAGE, msg); }
+
+  /// Record one odometry message under the given topic name.
+  void Record(const std::string& topic_name, const Odometry& msg) { Append(topic_name, detail::RecordType::ODOMETRY, msg); }
+
+ private:
+  template <typename T>
+  void Append(const std::string& topic_name, detail::RecordType type, const T& msg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || !TopicEnabled(topic_name)) {
+      return;
+    }
+
+    scratch_.clear();
+    detail::Serialize(scratch_, msg);
+
+    size_t record_size = 1 + 4 + topic_name.size() + 8 + 4 + scratch_.size();
+    if (active_buffer_.size() + record_size > static_cast<size_t>(options_.write_buffer_bytes)) {
+      stats_.drop_count++;
+      return;
+    }
+
+    int64_t capture_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+    detail::AppendPod(active_buffer_, static_cast<uint8_t>(type));
+    detail::AppendString(active_buffer_, topic_name);
+    detail::AppendPod(active_buffer_, capture_ns);
+    detail::AppendVector(active_buffer_, scratch_);
+
+    stats_.message_count++;
+    stats_.byte_count += record_size;
+    auto& entry = topic_directory_[topic_name];
+    entry.first = static_cast<uint8_t>(type);
+    entry.second++;
+
+    // Only wake the writer when the buffer crosses the high-water mark; below it, records
+    // batch up until the periodic flush_interval_ms flush. Waking per record would turn
+    // every message into its own write+flush and defeat the double buffering.
+    if (active_buffer_.size() >= HighWaterBytes()) {
+      cv_.notify_one();
+    }
+  }
+
+  size_t HighWaterBytes() const { return static_cast<size_t>(options_.write_buffer_bytes) / 2; }
+
+  bool TopicEnabled(const std::string& topic_name) const {
+    if (options_.topics.empty()) {
+      return true;
+    }
+    for (const std::string& topic : options_.topics) {
+      if (topic == topic_name) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WriterLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait_for(lock, std::chrono::milliseconds(options_.flush_interval_ms),
+                   [this] { return !running_ || active_buffer_.size() >= HighWaterBytes(); });
+      bool stopping = !running_;
+      active_buffer_.swap(write_buffer_);
+
+      // All file IO happens with the mutex released, so Record never blocks on disk
+      lock.unlock();
+      if (!write_buffer_.empty()) {
+        file_.write(reinterpret_cast<const char*>(write_buffer_.data()), static_cast<std::streamsize>(write_buffer_.size()));
+        write_buffer_.clear();
+      }
+      file_.flush();
+      lock.lock();
+
+      if (stopping && active_buffer_.empty()) {
+        return;
+      }
+    }
+  }
+
+  // Requires mutex_ held and the writer thread stopped.
+  void WriteIndex() {
+    uint64_t index_offset = static_cast<uint64_t>(file_.tellp());
+    file_.write(detail::kIndexMagic, sizeof(detail::kIndexMagic));
+    std::vector<uint8_t> index;
+    detail::AppendPod(index, static_cast<uint32_t>(topic_directory_.size()));
+    for (const auto& [name, entry] : topic_directory_) {
+      detail::AppendString(index, name);
+      detail::AppendPod(index, entry.first);
+      detail::AppendPod(index, entry.second);
+    }
+    detail::AppendPod(index, index_offset);
+    file_.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+  }
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread writer_;
+  bool running_ = false;
+
+  RecordOptions options_;
+  RecordStats stats_;
+  std::ofstream file_;
+  std::vector<uint8_t> active_buffer_;  // Filled by Record under mutex_
+  std::vector<uint8_t> write_buffer_;   // Drained to disk by the writer thread
+  std::vector<uint8_t> scratch_;        // Reused serialization buffer
+
+  std::map<std::string, std::pair<uint8_t, uint64_t>> topic_directory_;  // topic -> (type, message count)
+};
+
+/**
+ * @class TopicPlayer
+ * @brief Replays a recorded log through the same callback signatures as live subscriptions.
+ *
+ * Subscribe per topic with the familiar callback types, then Play drives the log in capture
+ * order: at real time (speed 1.0), a speed multiple, or as fast as the callbacks can consume
+ * (speed 0).
+ */
+class TopicPlayer : public NonCopyable {
+  // Callback type definitions matching the live subscription signatures
+  using JointStateCallback = std::function<void(const std::shared_ptr<JointState>)>;
+  using ImuCallback = std::function<void(const std::shared_ptr<Imu>)>;
+  using PointCloudCallback = std::function<void(const std::shared_ptr<PointCloud2>)>;
+  using ImageCallback = std::function<void(const std::shared_ptr<Image>)>;
+  using OdometryCallback = std::function<void(const std::shared_ptr<Odometry>)>;
+
+ public:
+  TopicPlayer() = default;
+
+  /// Destructor, stops playback and releases resources.
+  ~TopicPlayer() { Close(); }
+
+  /**
+   * @brief Open a recorded log file and read its topic directory.
+   * @param path Path of a log produced by TopicRecorder.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status Open(const std::string& path) {
+    Close();
+    file_.open(path, std::ios::binary);
+    if (!file_.is_open()) {
+      return {ErrorCode::INTERNAL_ERROR, "failed to open log file"};
+    }
+
+    char magic[sizeof(detail::kLogMagic)];
+    file_.read(magic, sizeof(magic));
+    if (!file_ || std::memcmp(magic, detail::kLogMagic, sizeof(magic)) != 0) {
+      file_.close();
+      return {ErrorCode::INTERNAL_ERROR, "not a topic log file"};
+    }
+
+    // The last 8 bytes point at the topic directory. Lengths read from the file are untrusted
+    // until checked against the bytes actually present, so a truncated or corrupt log fails
+    // with a Status instead of attempting a huge allocation.
+    file_.seekg(0, std::ios::end);
+    uint64_t file_size = static_cast<uint64_t>(file_.tellg());
+    file_.seekg(-static_cast<std::streamoff>(sizeof(uint64_t)), std::ios::end);
+    uint64_t index_offset = 0;
+    file_.read(reinterpret_cast<char*>(&index_offset), sizeof(index_offset));
+    if (!file_ || index_offset < sizeof(detail::kLogMagic) || index_offset + sizeof(detail::kIndexMagic) + sizeof(uint32_t) > file_size) {
+      file_.close();
+      return {ErrorCode::INTERNAL_ERROR, "log file has no topic directory (recording not stopped cleanly?)"};
+    }
+    file_.seekg(static_cast<std::streamoff>(index_offset));
+    char index_magic[sizeof(detail::kIndexMagic)];
+    file_.read(index_magic, sizeof(index_magic));
+    if (!file_ || std::memcmp(index_magic, detail::kIndexMagic, sizeof(index_magic)) != 0) {
+      file_.close();
+      return {ErrorCode::INTERNAL_ERROR, "log file has no topic directory (recording not stopped cleanly?)"};
+    }
+
+    uint32_t topic_count = 0;
+    file_.read(reinterpret_cast<char*>(&topic_count), sizeof(topic_count));
+    topic_names_.clear();
+    for (uint32_t ii = 0; ii < topic_count && file_; ii++) {
+      uint32_t name_length = 0;
+      file_.read(reinterpret_cast<char*>(&name_length), sizeof(name_length));
+      if (!file_ || name_length > file_size - static_cast<uint64_t>(file_.tellg())) {
+        file_.close();
+        return {ErrorCode::INTERNAL_ERROR, "corrupt topic directory"};
+      }
+      std::string name(name_length, '\0');
+      file_.read(name.data(), name_length);
+      uint8_t type = 0;
+      uint64_t count = 0;
+      file_.read(reinterpret_cast<char*>(&type), sizeof(type));
+      file_.read(reinterpret_cast<char*>(&count), sizeof(count));
+      topic_names_.push_back(std::move(name));
+    }
+    if (!file_) {
+      file_.close();
+      return {ErrorCode::INTERNAL_ERROR, "corrupt topic directory"};
+    }
+
+    records_end_ = static_cast<std::streamoff>(index_offset);
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Close the log file and drop all subscriptions.
+   */
+  void Close() {
+    Stop();
+    if (file_.is_open()) {
+      file_.close();
+    }
+    topic_names_.clear();
+    joint_state_callbacks_.clear();
+    imu_callbacks_.clear();
+    point_cloud_callbacks_.clear();
+    image_callbacks_.clear();
+    odometry_callbacks_.clear();
+  }
+
+  /**
+   * @brief Get the names of the topics contained in the opened log.
+   */
+  std::vector<std::string> GetTopicNames() const { return topic_names_; }
+
+  /// Subscribe to a recorded joint state topic, same callback signature as the live subscription.
+  void Subscribe(const std::string& topic_name, JointStateCallback callback) { joint_state_callbacks_[topic_name] = std::move(callback); }
+
+  /// Subscribe to a recorded IMU topic, same callback signature as the live subscription.
+  void Subscribe(const std::string& topic_name, ImuCallback callback) { imu_callbacks_[topic_name] = std::move(callback); }
+
+  /// Subscribe to a recorded point cloud topic, same callback signature as the live subscription.
+  void Subscribe(const std::string& topic_name, PointCloudCallback callback) { point_cloud_callbacks_[topic_name] = std::move(callback); }
+
+  /// Subscribe to a recorded image topic, same callback signature as the live subscription.
+  void Subscribe(const std::string& topic_name, ImageCallback callback) { image_callbacks_[topic_name] = std::move(callback); }
+
+  /// Subscribe to a recorded odometry topic, same callback signature as the live subscription.
+  void Subscribe(const std::string& topic_name, OdometryCallback callback) { odometry_callbacks_[topic_name] = std::move(callback); }
+
+  /**
+   * @brief Replay the log from the beginning, invoking subscribed callbacks in capture order.
+   * @param speed Playback speed multiple; 1.0 replays with the recorded inter-message timing,
+   *        0 replays as fast as the callbacks can consume.
+   * @return Operation status; returns once the end of the log is reached or Stop is called.
+   */
+  Status Play(double speed = 1.0) {
+    if (!file_.is_open()) {
+      return {ErrorCode::INTERNAL_ERROR, "no log file open"};
+    }
+    stop_requested_ = false;
+    file_.clear();
+    file_.seekg(static_cast<std::streamoff>(sizeof(detail::kLogMagic)));
+
+    int64_t previous_capture_ns = 0;
+    std::vector<uint8_t> payload;
+    while (!stop_requested_ && file_.tellg() < records_end_) {
+      uint8_t type = 0;
+      uint32_t name_length = 0;
+      int64_t capture_ns = 0;
+      uint32_t payload_length = 0;
+      file_.read(reinterpret_cast<char*>(&type), sizeof(type));
+      file_.read(reinterpret_cast<char*>(&name_length), sizeof(name_length));
+      if (!file_) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record"};
+      }
+      // Framing lengths are untrusted: cap them against the bytes left before the directory,
+      // so a log truncated mid-write fails with a Status instead of a huge allocation.
+      std::streamoff remaining = records_end_ - file_.tellg();
+      if (static_cast<std::streamoff>(name_length) + static_cast<std::streamoff>(sizeof(capture_ns) + sizeof(payload_length)) > remaining) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record framing"};
+      }
+      std::string topic_name(name_length, '\0');
+      file_.read(topic_name.data(), name_length);
+      file_.read(reinterpret_cast<char*>(&capture_ns), sizeof(capture_ns));
+      file_.read(reinterpret_cast<char*>(&payload_length), sizeof(payload_length));
+      if (!file_) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record"};
+      }
+      remaining = records_end_ - file_.tellg();
+      if (static_cast<std::streamoff>(payload_length) > remaining) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record framing"};
+      }
+      payload.resize(payload_length);
+      file_.read(reinterpret_cast<char*>(payload.data()), payload_length);
+      if (!file_) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record"};
+      }
+
+      if (speed > 0.0 && previous_capture_ns != 0 && capture_ns > previous_capture_ns) {
+        auto delay = std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(capture_ns - previous_capture_ns) / speed));
+        std::this_thread::sleep_for(delay);
+      }
+      previous_capture_ns = capture_ns;
+
+      if (!Dispatch(static_cast<detail::RecordType>(type), topic_name, payload)) {
+        return {ErrorCode::INTERNAL_ERROR, "corrupt record payload"};
+      }
+    }
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Stop an in-progress Play call.
+   */
+  void Stop() { stop_requested_ = true; }
+
+ private:
+  template <typename T, typename CallbackMap>
+  bool DispatchTo(const CallbackMap& callbacks, const std::string& topic_name, const std::vector<uint8_t>& payload) {
+    auto it = callbacks.find(topic_name);
+    detail::PayloadReader reader(payload.data(), payload.size());
+    auto msg = std::make_shared<T>();
+    if (!detail::Deserialize(reader, *msg)) {
+      return false;
+    }
+    if (it != callbacks.end() && it->second) {
+      it->second(msg);
+    }
+    return true;
+  }
+
+  bool Dispatch(detail::RecordType type, const std::string& topic_name, const std::vector<uint8_t>& payload) {
+    switch (type) {
+      case detail::RecordType::JOINT_STATE:
+        return DispatchTo<JointState>(joint_state_callbacks_, topic_name, payload);
+      case detail::RecordType::IMU:
+        return DispatchTo<Imu>(imu_callbacks_, topic_name, payload);
+      case detail::RecordType::POINT_CLOUD:
+        return DispatchTo<PointCloud2>(point_cloud_callbacks_, topic_name, payload);
+      case detail::RecordType::IMAGE:
+        return DispatchTo<Image>(image_callbacks_, topic_name, payload);
+      case detail::RecordType::ODOMETRY:
+        return DispatchTo<Odometry>(odometry_callbacks_, topic_name, payload);
+    }
+    return false;
+  }
+
+  std::ifstream file_;
+  std::streamoff records_end_ = 0;
+  std::vector<std::string> topic_names_;
+  std::atomic_bool stop_requested_{false};
+
+  std::map<std::string, JointStateCallback> joint_state_callbacks_;
+  std::map<std::string, ImuCallback> imu_callbacks_;
+  std::map<std::string, PointCloudCallback> point_cloud_callbacks_;
+  std::map<std::string, ImageCallback> image_callbacks_;
+  std::map<std::string, OdometryCallback> odometry_callbacks_;
+};
+
+}  // namespace magic::z1::record
@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -30,6 +32,9 @@ using namespace slam;
  * and providing unified interfaces for external access to high-level/low-level controllers, audio controllers, and sensor controllers.
  */
 class MAGIC_EXPORT_API MagicRobot final : public NonCopyable {
+  // Connection lifecycle callback type definition
+  using ConnectionEventCallback = std::function<void(const ConnectionEventType)>;
+
  public:
   /**
    * @brief Constructor, creates MagicRobot instance.
@@ -48,6 +53,17 @@ class MAGIC_EXPORT_API MagicRobot final : public NonCopyable {
    */
   bool Initialize(const std::string& local_ip);
 
+  /**
+   * @brief Initialize robot system with an explicit transport mode.
+   * @param local_ip Local IP address for communication binding or identity identification.
+   * @param transport Transport mode. With TransportMode::AUTO the SDK detects whether it runs on the
+   *        robot's onboard computer and, if so, backs all Subscribe/Publish channels with same-host
+   *        shared-memory rings, removing the serialize/socket/deserialize hops; remote processes keep
+   *        the network transport. The subscription and publish APIs behave identically in both modes.
+   * @return Whether initialization was successful.
+   */
+  bool Initialize(const std::string& local_ip, TransportMode transport);
+
   /**
    * @brief Shutdown robot system and release resources.
    */
@@ -70,6 +86,34 @@ class MAGIC_EXPORT_API MagicRobot final : public NonCopyable {
    */
   Status Disconnect();
 
+  /**
+   * @brief Get the current connection health.
+   * @param health Output health: probe round-trip time, jitter and reconnect counters.
+   * @return Operation status, returns Status::OK on success.
+   * @note Lightweight probes run periodically in the background once Connect succeeds.
+   */
+  Status GetConnectionHealth(ConnectionHealth& health);
+
+  /**
+   * @brief Configure automatic reconnection after a connection drop.
+   * @param options Reconnect behavior: enable flag and exponential backoff bounds.
+   * @return Operation status, returns Status::OK on success.
+   * @note On resume the SDK transparently re-arms all existing subscriptions and open streams
+   *       (odometry, audio, wakeup); callers do not need to re-subscribe.
+   */
+  Status SetReconnectOptions(const ReconnectOptions& options);
+
+  /**
+   * @brief Subscribe to connection lifecycle events (disconnected, reconnecting, session resumed).
+   * @param callback Processing callback invoked on each connection state change.
+   */
+  void SubscribeConnectionEvents(const ConnectionEventCallback callback);
+
+  /**
+   * @brief Unsubscribe from connection lifecycle events.
+   */
+  void UnsubscribeConnectionEvents();
+
   /**
    * @brief Get SDK version number.
    * @return Current SDK version string, e.g., "1.2.3".
@@ -89,6 +133,35 @@ class MAGIC_EXPORT_API MagicRobot final : public NonCopyable {
    */
   Status SetMotionControlLevel(ControllerLevel level);
 
+  /**
+   * @brief Get the current state of the host/robot clock synchronization.
+   * @param state Output state: offset, skew, probe round-trip time. Timestamps are converted
+   *        with TimeSyncState::ToHostTime / TimeSyncState::ToRobotTime on the returned state.
+   * @return Operation status, returns Status::OK on success.
+   * @note Probes run continuously in the background once Connect succeeds, no setup is required.
+   */
+  Status GetTimeSyncState(TimeSyncState& state);
+
+  /**
+   * @brief Create a named executor pool for subscription callbacks.
+   * @param config Pool configuration: name, thread count, SCHED_FIFO priority and CPU affinity.
+   * @return Creation result status. Fails if a pool with the same name already exists or the
+   *         scheduling parameters are rejected by the OS (e.g., missing CAP_SYS_NICE).
+   * @note Must be called after Initialize and before the topics assigned to the pool are subscribed.
+   */
+  Status CreateExecutorPool(const ExecutorPoolConfig& config);
+
+  /**
+   * @brief Assign a subscription topic to a named executor pool.
+   * @param topic_name Topic name. Motion topics: "arm_joint_state", "leg_joint_state",
+   *        "head_joint_state", "waist_joint_state", "hand_state", "body_imu", "estimator_state";
+   *        sensor topics: "lidar_imu", "lidar_point_cloud", "head_rgbd_color_image",
+   *        "head_rgbd_depth_image", "binocular_image"; slam topics: "odometry".
+   * @param pool_name Name of a pool previously created with CreateExecutorPool.
+   * @return Assignment result status. Topics not assigned to any pool stay on the default pool.
+   */
+  Status AssignTopicToExecutor(const std::string& topic_name, const std::string& pool_name);
+
   /**
    * @brief Get high-level motion controller object.
    * @return Reference type for users to call high-level motion control interfaces.
@@ -128,4 +201,163 @@ class MAGIC_EXPORT_API MagicRobot final : public NonCopyable {
  private:
   std::atomic_bool is_shutdown_{true};  // Mark whether initialized
 };
+
+/**
+ * @class MagicRobotGroup
+ * @brief Fleet-level manager owning several named MagicRobot instances.
+ *
+ * Centralizes the connection lifecycle of a multi-robot host: robots are added by name, their
+ * initialize/connect/disconnect sequencing is handled by the group, and Shutdown tears all of
+ * them down. Controllers obtained through GetRobot expose the same interfaces as a standalone
+ * MagicRobot. Each robot still runs on the SDK runtime's own transport threads; the group does
+ * not (yet) multiplex them over a shared event loop.
+ */
+class MagicRobotGroup final : public NonCopyable {
+ public:
+  MagicRobotGroup() = default;
+
+  /// Destructor, shuts down all robots still in the group.
+  ~MagicRobotGroup() { Shutdown(); }
+
+  /**
+   * @brief Initialize the group.
+   * @param local_ip Default local IP address used for robots added without an explicit one.
+   * @return Whether initialization was successful.
+   */
+  bool Initialize(const std::string& local_ip) {
+    default_local_ip_ = local_ip;
+    is_shutdown_ = false;
+    return true;
+  }
+
+  /**
+   * @brief Disconnect and shutdown all robots and release group resources.
+   */
+  void Shutdown() {
+    if (is_shutdown_.exchange(true)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Entry& entry : robots_) {
+      entry.robot->Disconnect();
+      entry.robot->Shutdown();
+    }
+    robots_.clear();
+  }
+
+  /**
+   * @brief Add a robot to the group: create, initialize and connect it.
+   * @param name Caller-chosen unique robot name, used with GetRobot/RemoveRobot.
+   * @param local_ip Local IP address of the interface reaching this robot; empty uses the
+   *        group's default (with one direct ethernet link per robot, each robot typically
+   *        binds a different local interface).
+   * @return Operation status; on failure the partially constructed robot is shut down and
+   *         not added.
+   */
+  Status AddRobot(const std::string& name, const std::string& local_ip = "") {
+    std::string ip;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (is_shutdown_.load()) {
+        return {ErrorCode::SERVICE_NOT_READY, "group not initialized"};
+      }
+      if (Find(name) != robots_.end()) {
+        return {ErrorCode::INTERNAL_ERROR, "robot name already in use"};
+      }
+      ip = local_ip.empty() ? default_local_ip_ : local_ip;
+    }
+
+    // Initialize and connect without holding mutex_: a network connect can take seconds and
+    // must not block GetRobot/GetRobotNames/RemoveRobot on the rest of the fleet.
+    auto robot = std::make_unique<MagicRobot>();
+    if (!robot->Initialize(ip)) {
+      robot->Shutdown();
+      return {ErrorCode::INTERNAL_ERROR, "robot initialize failed"};
+    }
+    Status status = robot->Connect();
+    if (status.code != ErrorCode::OK) {
+      robot->Shutdown();
+      return status;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Re-check under the lock: the group may have shut down, or the name been taken, while
+      // this robot was connecting. Inserting past a shutdown would leak a connected robot.
+      if (!is_shutdown_.load() && Find(name) == robots_.end()) {
+        robots_.push_back(Entry{name, std::move(robot)});
+        return {ErrorCode::OK, ""};
+      }
+      status = is_shutdown_.load() ? Status{ErrorCode::SERVICE_NOT_READY, "group shut down while connecting"}
+                                   : Status{ErrorCode::INTERNAL_ERROR, "robot name already in use"};
+    }
+    robot->Disconnect();
+    robot->Shutdown();
+    return status;
+  }
+
+  /**
+   * @brief Disconnect a robot and remove it from the group.
+   * @param name Robot name passed to AddRobot.
+   * @return Operation status, returns Status::OK on success.
+   */
+  Status RemoveRobot(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = Find(name);
+    if (it == robots_.end()) {
+      return {ErrorCode::INTERNAL_ERROR, "unknown robot name"};
+    }
+    it->robot->Disconnect();
+    it->robot->Shutdown();
+    robots_.erase(it);
+    return {ErrorCode::OK, ""};
+  }
+
+  /**
+   * @brief Get a robot of the group.
+   * @param name Robot name passed to AddRobot.
+   * @return Pointer to the robot, valid until the robot is removed or the group shuts down;
+   *         nullptr when no robot with that name is in the group.
+   */
+  MagicRobot* GetRobot(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = Find(name);
+    return it == robots_.end() ? nullptr : it->robot.get();
+  }
+
+  /**
+   * @brief Get the names of all robots currently in the group.
+   * @return Robot names in the order they were added.
+   */
+  std::vector<std::string> GetRobotNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> names;
+    names.reserve(robots_.size());
+    for (const Entry& entry : robots_) {
+      names.push_back(entry.name);
+    }
+    return names;
+  }
+
+ private:
+  struct Entry {
+    std::string name;
+    std::unique_ptr<MagicRobot> robot;
+  };
+
+  // Requires mutex_ held.
+  std::vector<Entry>::iterator Find(const std::string& name) {
+    for (auto it = robots_.begin(); it != robots_.end(); ++it) {
+      if (it->name == name) {
+        return it;
+      }
+    }
+    return robots_.end();
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<Entry> robots_;
+  std::string default_local_ip_;
+  std::atomic_bool is_shutdown_{true};  // Mark whether initialized
+};
 }  // namespace magic::z1
\ No newline at end of file
@@ -23,6 +23,7 @@ using SensorControllerPtr = std::unique_ptr<SensorController>;
 class MAGIC_EXPORT_API SensorController final : public NonCopyable {
   // Message pointer type definitions (smart pointers for memory management)
   using PointCloudPtr = std::shared_ptr<PointCloud2>;                // Point cloud message pointer
+  using PointCloudLoanPtr = std::shared_ptr<PointCloudLoan>;         // Borrowed point cloud frame pointer
   using ImuPtr = std::shared_ptr<Imu>;                               // IMU inertial measurement unit message pointer
   using ImagePtr = std::shared_ptr<Image>;                           // Image message pointer
   using CameraInfoPtr = std::shared_ptr<CameraInfo>;                 // Camera intrinsic parameter information pointer
@@ -30,7 +31,8 @@ class MAGIC_EXPORT_API SensorController final : public NonCopyable {
 
   // Callback function type definitions for various sensor data
   using LidarImuCallback = std::function<void(const ImuPtr)>;                    // Lidar IMU data callback
-  using LidarPointCloudCallback = std::function<void(const PointCloudPtr)>;      // Lidar point cloud data callback
+  using LidarPointCloudCallback = std::function<void(const PointCloudPtr)>;          // Lidar point cloud data callback
+  using LidarPointCloudLoanCallback = std::function<void(const PointCloudLoanPtr)>;  // Lidar point cloud loaned-buffer callback
   using RgbdImageCallback = std::function<void(const ImagePtr)>;                 // RGBD image data callback
   using CameraInfoCallback = std::function<void(const CameraInfoPtr)>;           // RGBD camera intrinsic parameter callback
   using BinocularImageCallback = std::function<void(const BinocularCameraPtr)>;  // Binocular camera image frame callback
@@ -61,6 +63,23 @@ class MAGIC_EXPORT_API SensorController final : public NonCopyable {
    */
   Status OpenLidar();
 
+  /**
+   * @brief Open Lidar with stream options.
+   * @param options Stream options, e.g. point cloud compression codec negotiated with the robot.
+   * @return Operation status.
+   */
+  Status OpenLidar(const LidarStreamOptions& options);
+
+  /**
+   * @brief Set point cloud filtering applied on the robot before transmission.
+   * @param options Filter options: voxel leaf size, range/angle ROI and point cap.
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Operation status.
+   * @note Takes effect from the next published frame; can be changed while the lidar is open.
+   *       Passing a default-constructed options object restores the unfiltered stream.
+   */
+  Status SetLidarPointCloudFilter(const PointCloudFilterOptions& options, int timeout_ms = 5000);
+
   /**
    * @brief Close Lidar.
    * @return Operation status.
@@ -89,12 +108,52 @@ class MAGIC_EXPORT_API SensorController final : public NonCopyable {
    */
   Status OpenBinocularCamera();
 
+  /**
+   * @brief Open binocular camera with stream options.
+   * @param options Stream options: hardware compression codec and optional SDK-side decode.
+   * @return Operation status.
+   */
+  Status OpenBinocularCamera(const BinocularStreamOptions& options);
+
   /**
    * @brief Close binocular camera.
    * @return Operation status.
    */
   Status CloseBinocularCamera();
 
+  // === Subscription QoS ===
+
+  /**
+   * @brief Set the quality-of-service of a topic's subscription queue
+   * @param topic Topic to configure
+   * @param qos Queue depth and drop policy; defaults bound every topic to 10 queued messages with drop-oldest
+   * @return Operation status.
+   * @note State-like topics are best served with a depth of 1, which degenerates to keep-last
+   *       semantics: after a link stall the callback sees the newest sample instead of a replay.
+   */
+  Status SetSubscriptionQos(SensorDataTopic topic, const TopicQos& qos);
+
+  // === Frame Buffer Pooling ===
+
+  /**
+   * @brief Recycle a topic's frame buffers through a fixed-size pool instead of allocating per message
+   * @param topic Topic whose delivery buffers should be pooled
+   * @param pool_depth Number of preallocated frame buffers cycling through the pool
+   * @return Operation status.
+   * @note Delivered shared_ptr objects carry a deleter that returns the buffer to the pool when the
+   *       last reference is dropped, so at 30fps image rates the allocator is not touched at all.
+   *       Callbacks that hold references longer than pool_depth frames will stall delivery; size the
+   *       pool for the longest pipeline stage. Takes effect for subscriptions armed after the call.
+   */
+  Status EnableFramePool(SensorDataTopic topic, int32_t pool_depth);
+
+  /**
+   * @brief Return a topic to per-message allocation and release its pool
+   * @param topic Topic whose frame pool should be released
+   * @return Operation status.
+   */
+  Status DisableFramePool(SensorDataTopic topic);
+
   // 订阅各类传感器数据的函数接口
 
   /**
@@ -119,6 +178,20 @@ class MAGIC_EXPORT_API SensorController final : public NonCopyable {
    */
   void UnsubscribeLidarPointCloud();
 
+  /**
+   * @brief Subscribe to lidar point cloud data without copying the payload
+   * @param callback Processing callback, receives a loan of the transport's receive buffer
+   * @note The point data stays valid until PointCloudLoan::Release() is called (or the loan object is destroyed).
+   *       Release promptly: the transport cannot reuse the buffer while it is on loan.
+   *       Only one of SubscribeLidarPointCloud and SubscribeLidarPointCloudLoaned can be active at a time.
+   */
+  void SubscribeLidarPointCloudLoaned(const LidarPointCloudLoanCallback callback);
+
+  /**
+   * @brief Unsubscribe from loaned lidar point cloud data
+   */
+  void UnsubscribeLidarPointCloudLoaned();
+
   /**
    * @brief Subscribe to head RGBD color image data
    * @param callback Processing callback after receiving image data
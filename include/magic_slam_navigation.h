@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -15,7 +16,11 @@ using SlamNavControllerPtr = std::unique_ptr<SlamNavController>;
 
 class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
   using LocalizationInfoPtr = std::shared_ptr<LocalizationInfo>;
+  // Map transfer progress callback, invoked after each completed tile
+  using MapTransferProgressCallback = std::function<void(const MapTransferProgress&)>;
   using OdometryCallback = std::function<void(const std::shared_ptr<Odometry>)>;
+  // Fixed-layout odometry callback: the referenced object is reused by the SDK and only valid during the callback
+  using OdometryFixedCallback = std::function<void(const OdometryFixed&)>;
   using PointCloudMapCallback = std::function<void(const std::shared_ptr<PointCloud2>)>;
 
  public:
@@ -49,6 +54,16 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status ActivateSlamMode(SlamMode mode, std::string map_path = "", int timeout_ms = 5000);
 
+  /**
+   * @brief Asynchronous variant of ActivateSlamMode, returns immediately.
+   * @param mode Mode to switch to, such as idle mode/localization mode/mapping mode, etc.
+   * @param map_path Map path, when mode is localization mode
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the operation status once the mode switch completes or times out.
+   * @note In-flight requests are pipelined on the existing connection, no thread is spawned per call.
+   */
+  std::future<Status> ActivateSlamModeAsync(SlamMode mode, std::string map_path = "", int timeout_ms = 5000);
+
   /**
    * @brief Start mapping
    * @param timeout_ms Timeout in milliseconds, default is 10000
@@ -71,6 +86,26 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status SaveMap(const std::string& map_name, int timeout_ms = 5000);
 
+  /**
+   * @brief End mapping and save the map through a pipelined, compressed tile transfer
+   * @param map_name Map name
+   * @param options Transfer options: tile size, parallelism and compression
+   * @param progress Progress callback invoked after each completed tile, may be nullptr
+   * @param timeout_ms Timeout in milliseconds, default is 60000 (covers large site maps)
+   * @return Operation status, returns Status::OK on success
+   * @note The transfer runs on a dedicated channel, so concurrent SlamNavController RPCs
+   *       (navigation goals, pose queries) are not blocked while the map moves.
+   */
+  Status SaveMap(const std::string& map_name, const MapTransferOptions& options, const MapTransferProgressCallback progress, int timeout_ms = 60000);
+
+  /**
+   * @brief Asynchronous variant of SaveMap, returns immediately.
+   * @param map_name Map name
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the operation status once the map is saved or the request times out.
+   */
+  std::future<Status> SaveMapAsync(const std::string& map_name, int timeout_ms = 5000);
+
   /**
    * @brief load map and set as the current map
    * @param map_name Map name
@@ -79,6 +114,24 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status LoadMap(const std::string& map_name, int timeout_ms = 5000);
 
+  /**
+   * @brief Load a map through a pipelined, compressed tile transfer and set it as current
+   * @param map_name Map name
+   * @param options Transfer options: tile size, parallelism and compression
+   * @param progress Progress callback invoked after each completed tile, may be nullptr
+   * @param timeout_ms Timeout in milliseconds, default is 60000 (covers large site maps)
+   * @return Operation status, returns Status::OK on success
+   */
+  Status LoadMap(const std::string& map_name, const MapTransferOptions& options, const MapTransferProgressCallback progress, int timeout_ms = 60000);
+
+  /**
+   * @brief Asynchronous variant of LoadMap, returns immediately.
+   * @param map_name Map name
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the operation status once the map is loaded or the request times out.
+   */
+  std::future<Status> LoadMapAsync(const std::string& map_name, int timeout_ms = 5000);
+
   /**
    * @brief Delete map
    * @param map_name Name of the map to delete
@@ -104,6 +157,39 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status GetAllMapInfo(AllMapInfo& all_map_info, int timeout_ms = 5000);
 
+  /**
+   * @brief Get metadata of all stored maps without transferring image payloads
+   * @param all_map_meta_info Metadata of all stored maps (output parameter)
+   * @param timeout_ms Timeout in milliseconds, default is 10000
+   * @return Operation status, returns Status::OK on success
+   * @note Listing stays cheap regardless of how many maps the robot stores; fetch image data
+   *       on demand with GetMapImageData or GetMapImageTile.
+   */
+  Status GetAllMapMetaInfo(AllMapMetaInfo& all_map_meta_info, int timeout_ms = 5000);
+
+  /**
+   * @brief Get the full image data of a single map
+   * @param map_name Map name
+   * @param map_image_data Image data of the map (output parameter)
+   * @param timeout_ms Timeout in milliseconds, default is 10000
+   * @return Operation status, returns Status::OK on success
+   */
+  Status GetMapImageData(const std::string& map_name, MapImageData& map_image_data, int timeout_ms = 10000);
+
+  /**
+   * @brief Get a rectangular tile of a single map's image
+   * @param map_name Map name
+   * @param x_offset Tile starting column (unit: pixel)
+   * @param y_offset Tile starting row (unit: pixel)
+   * @param width Tile width (unit: pixel), clamped to the map bounds
+   * @param height Tile height (unit: pixel), clamped to the map bounds
+   * @param tile Tile image data (output parameter), width/height carry the clamped size
+   * @param timeout_ms Timeout in milliseconds, default is 10000
+   * @return Operation status, returns Status::OK on success
+   * @note Lets a UI progressively load only the visible region of a large map.
+   */
+  Status GetMapImageTile(const std::string& map_name, uint32_t x_offset, uint32_t y_offset, uint32_t width, uint32_t height, MapImageData& tile, int timeout_ms = 5000);
+
   /**
    * @brief Initialize pose
    * @param pose Pose information to publish. Due to the lidar being installed with a -1.57rad offset relative to the robot's front, the desired yaw orientation needs to be offset by -1.57rad, otherwise the robot's pose initialization may fail
@@ -128,6 +214,15 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status ActivateNavMode(NavMode mode, std::string map_path = "", int timeout_ms = 5000);
 
+  /**
+   * @brief Asynchronous variant of ActivateNavMode, returns immediately.
+   * @param mode Target navigation mode (NavigationMode enumeration type)
+   * @param map_path Map path, when mode is GRID_MAP mode, map_path is the path of the map to be reused
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the operation status once the mode switch completes or times out.
+   */
+  std::future<Status> ActivateNavModeAsync(NavMode mode, std::string map_path = "", int timeout_ms = 5000);
+
   /**
    * @brief Set global navigation target point and start navigation task
    * @param goal Global coordinates of the target point
@@ -136,6 +231,14 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status SetNavTarget(const NavTarget& goal, int timeout_ms = 5000);
 
+  /**
+   * @brief Asynchronous variant of SetNavTarget, returns immediately.
+   * @param goal Global coordinates of the target point
+   * @param timeout_ms Timeout in milliseconds, default is 5000
+   * @return Future resolving to the operation status once the navigation task is accepted or times out.
+   */
+  std::future<Status> SetNavTargetAsync(const NavTarget& goal, int timeout_ms = 5000);
+
   /**
    * @brief Pause current navigation task
    * @param timeout_ms Timeout in milliseconds
@@ -165,12 +268,28 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   Status GetNavTaskStatus(NavStatus& nav_status);
 
+  /**
+   * @brief Set the quality-of-service of a topic's subscription queue
+   * @param topic Topic to configure
+   * @param qos Queue depth and drop policy; a depth of 1 keeps only the newest odometry sample
+   *        after a link stall instead of replaying the backlog
+   * @return Operation status, returns Status::OK on success
+   */
+  Status SetSubscriptionQos(SlamDataTopic topic, const TopicQos& qos);
+
   /**
    * @brief Open odometry stream
    * @return Operation status, returns Status::OK on success
    */
   Status OpenOdometryStream();
 
+  /**
+   * @brief Open odometry stream with stream options
+   * @param options Stream options: publish rate and fixed-layout delivery for high-rate consumers
+   * @return Operation status, returns Status::OK on success
+   */
+  Status OpenOdometryStream(const OdometryStreamOptions& options);
+
   /**
    * @brief Close odometry stream
    * @return Operation status, returns Status::OK on success
@@ -188,6 +307,23 @@ class MAGIC_EXPORT_API SlamNavController final : public NonCopyable {
    */
   void UnsubscribeOdometry();
 
+  /**
+   * @brief Subscribe to fixed-layout odometry data without per-message allocation
+   * @param callback Callback invoked with a reused OdometryFixed, valid only during the callback
+   * @note Requires the stream to be opened with OdometryStreamOptions::fixed_layout set.
+   *       Unsubscribed together with the regular subscription via UnsubscribeOdometry().
+   */
+  void SubscribeOdometryFixed(const OdometryFixedCallback callback);
+
+  /**
+   * @brief Fetch the newest fixed-layout odometry sample
+   * @param odometry Output sample, only written when a new sample is available
+   * @return true when a sample newer than the one previously returned to this caller was available
+   * @note Wait-free, backed by a lock-free latest-value slot; suitable for a control loop polling
+   *       at its own rate. Requires the stream to be opened with OdometryStreamOptions::fixed_layout set.
+   */
+  bool PollOdometry(OdometryFixed& odometry);
+
   /**
    * @brief Get point cloud map
    * @param point_cloud_map Point cloud map (output parameter)
@@ -4,6 +4,7 @@
 #include "magic_type.h"
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -21,6 +22,11 @@ using StateMonitorPtr = std::unique_ptr<StateMonitor>;
  */
 
 class MAGIC_EXPORT_API StateMonitor final : public NonCopyable {
+  // State change callback: the referenced event is preallocated and reused, only valid during the callback
+  using StateChangeCallback = std::function<void(const RobotStateEvent&)>;
+  // Fault event callback: the referenced record comes from the fixed-capacity ring, only valid during the callback
+  using FaultEventCallback = std::function<void(const FaultEvent&)>;
+
  public:
   /**
    * @brief Constructor, creates StateMonitor instance.
@@ -49,6 +55,57 @@ class MAGIC_EXPORT_API StateMonitor final : public NonCopyable {
    */
   Status GetCurrentState(RobotState& robot_state);
 
+  /**
+   * @brief Subscribe to pushed robot state changes
+   * @param callback Callback invoked for each delta: fault raised/cleared, battery level crossing
+   *        a threshold, battery or power supply state changes.
+   * @note Push-based alternative to polling GetCurrentState: faults are reported within 100ms of
+   *       being raised, and steady state costs neither RPCs nor allocations since only deltas are
+   *       transmitted and event objects are reused.
+   */
+  void SubscribeStateChanges(const StateChangeCallback callback);
+
+  /**
+   * @brief Unsubscribe from pushed robot state changes
+   */
+  void UnsubscribeStateChanges();
+
+  /**
+   * @brief Subscribe to fault edges at or above a severity
+   * @param min_severity Lowest severity to deliver; lower-severity events stay in the ring but
+   *        do not invoke the callback.
+   * @param callback Callback invoked for each fault raised/cleared edge.
+   * @note Events are POD records from a fixed-capacity ring, so subscription delivery performs
+   *       no allocation. Unlike diffing GetCurrentState, edges cannot be missed between polls.
+   */
+  void SubscribeFaultEvents(FaultSeverity min_severity, const FaultEventCallback callback);
+
+  /**
+   * @brief Unsubscribe from fault edges
+   */
+  void UnsubscribeFaultEvents();
+
+  /**
+   * @brief Fetch the next unconsumed fault event from the ring
+   * @param event Output record, only written when an unconsumed event was available.
+   * @return true when an event was fetched; call repeatedly until false to drain.
+   * @note Allocation-free alternative to the callback for safety loops that poll at their own
+   *       rate. The ring keeps the most recent events; a consumer lagging by more than the ring
+   *       capacity loses the oldest records.
+   */
+  bool PollFaultEvent(FaultEvent& event);
+
+  /**
+   * @brief Get transport statistics for all active subscription and command channels.
+   * @param stats Output statistics: per-topic message rate, throughput, queue depth high-water
+   *        mark, drop count and publish->deliver latency histogram, covering the channels of
+   *        SensorController, LowLevelMotionController and SlamNavController.
+   * @return Operation status, returns Status::OK on success.
+   * @note Counters are atomic and maintained on the hot path at negligible cost, so this can be
+   *       polled in production to tell link, SDK queue and user callback bottlenecks apart.
+   */
+  Status GetTransportStats(TransportStats& stats);
+
  private:
   std::atomic_bool is_shutdown_{true};  // Mark whether initialized
 };
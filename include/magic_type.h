@@ -1,8 +1,11 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace magic::z1 {
@@ -18,6 +21,8 @@ constexpr uint8_t kArmJointNum = 14;   ///< Number of arm joints (left and right
 constexpr uint8_t kWaistJointNum = 1;  ///< Number of waist joints
 constexpr uint8_t kLegJointNum = 12;   ///< Number of leg joints
 
+constexpr uint8_t kWholeBodyJointNum = kArmJointNum + kLegJointNum + kHeadJointNum + kWaistJointNum;  ///< Number of joints covered by a whole-body command
+
 /************************************************************
  *                        Interface Information               *
  ************************************************************/
@@ -35,6 +40,121 @@ struct Status {
   std::string message;
 };
 
+/**
+ * @brief Transport mode used between the SDK and the on-robot services
+ */
+enum class TransportMode : int8_t {
+  AUTO = 0,           ///< Use shared memory when the SDK runs on the robot's onboard computer, network otherwise
+  NETWORK = 1,        ///< Always use the network (gRPC/LCM/ZMQ) transport, even on the same host
+  SHARED_MEMORY = 2,  ///< Back all topics and command channels with same-host shared-memory rings; initialization fails if the robot services are not local
+};
+
+/**
+ * @brief Configuration of a named callback executor pool
+ *
+ * Subscription callbacks run on executor pools inside the SDK. By default all topics share one
+ * pool; creating dedicated pools and assigning topics to them keeps high-rate control topics
+ * (IMU, joint states) from queueing behind bulk image/point-cloud work.
+ */
+struct ExecutorPoolConfig {
+  std::string name;            ///< Pool name, referenced when assigning topics
+  int32_t thread_num = 1;      ///< Number of worker threads in the pool
+  int32_t sched_priority = 0;  ///< SCHED_FIFO priority of the workers (1-99), 0 keeps the default SCHED_OTHER policy
+  uint64_t cpu_affinity = 0;   ///< CPU affinity bit mask of the workers (bit n = CPU n), 0 leaves affinity unrestricted
+};
+
+/**
+ * @brief Health of the connection to the robot service
+ */
+struct ConnectionHealth {
+  bool connected = false;            ///< Whether the connection is currently established
+  double rtt_ms = 0.0;               ///< Round-trip time of the most recent health probe (unit: milliseconds)
+  double rtt_jitter_ms = 0.0;        ///< Smoothed probe round-trip jitter (unit: milliseconds)
+  int64_t last_probe_timestamp = 0;  ///< Host time of the most recent successful probe (unit: nanoseconds)
+  uint32_t reconnect_count = 0;      ///< Automatic reconnects performed since Connect
+};
+
+/**
+ * @brief Automatic reconnect behavior after a connection drop
+ */
+struct ReconnectOptions {
+  bool enable = true;               ///< Reconnect automatically when a health probe detects a drop
+  int32_t initial_backoff_ms = 20;  ///< Delay before the first reconnect attempt
+  int32_t max_backoff_ms = 2000;    ///< Upper bound of the exponential backoff between attempts
+};
+
+/**
+ * @brief Connection lifecycle event
+ */
+enum class ConnectionEventType : int8_t {
+  DISCONNECTED = 0,     ///< Probes stopped answering, the connection is considered lost
+  RECONNECTING = 1,     ///< An automatic reconnect attempt is in progress
+  SESSION_RESUMED = 2,  ///< The connection is back and all subscriptions and streams were re-armed
+};
+
+/**
+ * @brief State of the host/robot clock synchronization
+ *
+ * The SDK continuously exchanges NTP-style probes with the robot over the existing connection
+ * and tracks both the clock offset and its drift (skew), so robot-side timestamps can be
+ * aligned with host-side sensors at sub-millisecond accuracy.
+ */
+struct TimeSyncState {
+  bool synchronized = false;     ///< Whether enough probes have been exchanged for a valid estimate
+  double offset_ns = 0.0;        ///< Estimated robot clock minus host clock at the last probe (unit: nanoseconds)
+  double skew_ppm = 0.0;         ///< Estimated drift rate of that offset (unit: parts per million of elapsed host time)
+  double round_trip_ms = 0.0;    ///< Round-trip time of the most recent probe (unit: milliseconds)
+  int64_t last_probe_timestamp = 0;  ///< Host time of the most recent probe (unit: nanoseconds)
+
+  /**
+   * @brief Convert a robot-side timestamp to the host clock.
+   * @param robot_ns Robot-side timestamp (unit: nanoseconds), e.g. Imu::timestamp or Header::stamp.
+   * @return The corresponding host-side timestamp in nanoseconds, corrected for the offset and its
+   *         first-order drift since the last probe. Returns robot_ns unchanged while not synchronized.
+   */
+  int64_t ToHostTime(int64_t robot_ns) const {
+    if (!synchronized) {
+      return robot_ns;
+    }
+    int64_t host_ns = robot_ns - static_cast<int64_t>(offset_ns);
+    host_ns -= static_cast<int64_t>(skew_ppm * 1e-6 * static_cast<double>(host_ns - last_probe_timestamp));
+    return host_ns;
+  }
+
+  /**
+   * @brief Convert a host-side timestamp to the robot clock, inverse of ToHostTime.
+   * @param host_ns Host-side timestamp (unit: nanoseconds).
+   * @return The corresponding robot-side timestamp in nanoseconds. Returns host_ns unchanged while
+   *         not synchronized.
+   */
+  int64_t ToRobotTime(int64_t host_ns) const {
+    if (!synchronized) {
+      return host_ns;
+    }
+    return host_ns + static_cast<int64_t>(offset_ns + skew_ppm * 1e-6 * static_cast<double>(host_ns - last_probe_timestamp));
+  }
+};
+
+/**
+ * @brief Policy applied when a subscription queue is full
+ */
+enum class QosDropPolicy : int8_t {
+  DROP_OLDEST = 0,  ///< Discard the oldest queued message, keeping staleness bounded (recommended for state-like topics)
+  DROP_NEWEST = 1,  ///< Discard the incoming message, keeping the queued history intact
+};
+
+/**
+ * @brief Quality-of-service settings of one subscription
+ *
+ * Bounds how much data the SDK buffers for a topic when the consumer or the link stalls:
+ * after an outage the callback sees at most queue_depth queued messages instead of replaying
+ * seconds of stale data, and memory use per topic stays fixed.
+ */
+struct TopicQos {
+  int32_t queue_depth = 10;                                   ///< Maximum queued messages for the subscription
+  QosDropPolicy drop_policy = QosDropPolicy::DROP_OLDEST;     ///< What to drop when the queue is full
+};
+
 /************************************************************
  *                        Status Information                  *
  ************************************************************/
@@ -127,10 +247,114 @@ typedef struct robot_state {
   BmsData bms_data;           ///< Battery management system data
 } RobotState;
 
+/**
+ * @brief Severity of a fault event
+ */
+enum class FaultSeverity : int8_t {
+  INFO = 0,     ///< Informational, no action required
+  WARNING = 1,  ///< Degraded operation, e.g. sensor data gaps
+  ERROR = 2,    ///< A subsystem failed, intervention may be required
+  FATAL = 3,    ///< Robot cannot continue operating safely
+};
+
+constexpr uint8_t kFaultEventMessageLen = 48;  ///< Capacity of the inline fault event message, including the terminator
+
+/**
+ * @brief One fault edge as a fixed-size POD record
+ *
+ * Unlike Fault inside RobotState, this type carries no heap-allocated members: the short
+ * message is stored inline and truncated if necessary (the full text remains available via
+ * error_code_map). Records are delivered from a fixed-capacity ring, so a safety loop can
+ * consume fault edges allocation-free.
+ */
+struct FaultEvent {
+  uint16_t error_code = 0;                          ///< Fault error code (see error_code_map)
+  FaultSeverity severity = FaultSeverity::INFO;     ///< Fault severity
+  bool raised = false;                              ///< true when the fault was raised, false when it cleared
+  int64_t timestamp = 0;                            ///< Monotonic event timestamp (unit: nanoseconds)
+  std::array<char, kFaultEventMessageLen> message{};  ///< Inline null-terminated short message, truncated to fit
+};
+
+/**
+ * @brief Kind of a pushed robot state change
+ */
+enum class RobotStateEventType : int8_t {
+  FAULT_RAISED = 0,                  ///< A fault entered the fault list
+  FAULT_CLEARED = 1,                 ///< A fault left the fault list
+  BATTERY_LEVEL_CHANGED = 2,         ///< Battery percentage crossed a reporting threshold
+  BATTERY_STATE_CHANGED = 3,         ///< BatteryState value changed
+  POWER_SUPPLY_STATUS_CHANGED = 4,   ///< PowerSupplyStatus value changed
+};
+
+/**
+ * @brief One pushed robot state change
+ *
+ * Only the fields relevant to the event type are meaningful: fault_code for fault events,
+ * the BMS fields for battery events. Event objects delivered to callbacks are preallocated
+ * and reused, so steady-state delivery does not allocate.
+ */
+struct RobotStateEvent {
+  RobotStateEventType type = RobotStateEventType::FAULT_RAISED;  ///< Kind of change
+  int64_t timestamp = 0;                                         ///< Event timestamp (unit: nanoseconds)
+
+  int fault_code = 0;  ///< Fault error code, for FAULT_RAISED/FAULT_CLEARED (see error_code_map)
+
+  double battery_percentage = 0.0;                                     ///< Battery percentage, for BATTERY_LEVEL_CHANGED
+  BatteryState battery_state = BatteryState::UNKNOWN;                  ///< Battery state, for BATTERY_STATE_CHANGED
+  PowerSupplyStatus power_supply_status = PowerSupplyStatus::UNKNOWN;  ///< Charging status, for POWER_SUPPLY_STATUS_CHANGED
+};
+
+constexpr uint8_t kLatencyHistogramBucketNum = 32;  ///< Number of log2 buckets in per-topic latency histograms
+
+/**
+ * @brief Transport statistics of a single subscription or command channel
+ *
+ * All counters are maintained with relaxed atomics on the hot path, so collection is cheap
+ * enough to stay enabled in production. Counts accumulate since Initialize; rates are computed
+ * over the last second.
+ */
+struct TopicTransportStats {
+  std::string topic_name;  ///< Topic name, e.g. "lidar_point_cloud", "arm_joint_state"
+
+  uint64_t message_count = 0;  ///< Messages delivered (subscriptions) or sent (command channels) since Initialize
+  uint64_t byte_count = 0;     ///< Payload bytes moved since Initialize
+
+  double message_rate_hz = 0.0;   ///< Message rate over the last second
+  double bytes_per_second = 0.0;  ///< Throughput over the last second
+
+  uint32_t queue_depth = 0;             ///< Current depth of the topic's delivery queue
+  uint32_t queue_depth_high_water = 0;  ///< Highest delivery queue depth observed since Initialize
+  uint64_t drop_count = 0;              ///< Messages dropped (queue overflow or transport loss) since Initialize
+
+  /// Publish->deliver latency histogram: bucket n counts messages with latency in [2^n, 2^(n+1)) microseconds
+  std::array<uint64_t, kLatencyHistogramBucketNum> latency_histogram_us{};
+};
+
+/**
+ * @brief Transport statistics of all active channels
+ */
+struct TransportStats {
+  int64_t timestamp = 0;                  ///< Collection timestamp (unit: nanoseconds)
+  std::vector<TopicTransportStats> topics;  ///< One entry per active Subscribe/Publish channel
+};
+
 /************************************************************
  *                        Motion Control                      *
  ************************************************************/
 
+/**
+ * @brief Identifiers of the low-level motion data topics, used for per-topic configuration
+ */
+enum class LowLevelDataTopic : int8_t {
+  ARM_JOINT_STATE = 0,    ///< Arm joint state data
+  LEG_JOINT_STATE = 1,    ///< Leg joint state data
+  HEAD_JOINT_STATE = 2,   ///< Head joint state data
+  WAIST_JOINT_STATE = 3,  ///< Waist joint state data
+  HAND_STATE = 4,         ///< Hand state data
+  BODY_IMU = 5,           ///< Body IMU data
+  ESTIMATOR_STATE = 6,    ///< Estimator state data
+};
+
 /**
  * @brief Motion controller level type, used to distinguish different controller responsibilities.
  */
@@ -275,6 +499,35 @@ struct JointCommand {
   std::vector<SingleJointCommand> joints;  ///< Control commands for all joints
 };
 
+/**
+ * @brief Fixed-capacity variant of JointCommand
+ *
+ * Holds the same per-joint commands as JointCommand but in a std::array sized at compile time
+ * (kArmJointNum, kLegJointNum, ...), so a control loop can keep one instance alive and publish
+ * it every cycle without any heap allocation. The type is trivially copyable: a whole command
+ * is one memcpy into the transport.
+ */
+template <uint8_t N>
+struct JointCommandFixed {
+  int64_t timestamp = 0;                     ///< Timestamp (unit: nanoseconds)
+  std::array<SingleJointCommand, N> joints;  ///< Control commands for all joints, same order as JointCommand
+};
+
+/**
+ * @brief Control commands for all body joints in one message
+ *
+ * Aggregates the arm, leg, head and waist commands that would otherwise be published
+ * through four separate calls, so one publish serializes and ships a single wire message
+ * and the controller applies all kWholeBodyJointNum joints in the same control cycle.
+ */
+struct WholeBodyJointCommand {
+  int64_t timestamp = 0;                                      ///< Timestamp (unit: nanoseconds)
+  std::array<SingleJointCommand, kArmJointNum> arm_joints;    ///< Arm joint commands, same order as PublishArmCommand
+  std::array<SingleJointCommand, kLegJointNum> leg_joints;    ///< Leg joint commands, same order as PublishLegCommand
+  std::array<SingleJointCommand, kHeadJointNum> head_joints;  ///< Head joint commands, same order as PublishHeadCommand
+  std::array<SingleJointCommand, kWaistJointNum> waist_joints;  ///< Waist joint commands, same order as PublishWaistCommand
+};
+
 /**
  * @brief State information for a single joint
  */
@@ -301,6 +554,54 @@ struct JointState {
   std::vector<SingleJointState> joints;  ///< State data for all joints
 };
 
+/**
+ * @brief Fixed-capacity variant of JointState
+ *
+ * Same joint ordering as JointState, with the per-joint states in a compile-time sized
+ * std::array instead of a std::vector. Trivially copyable, suitable for lock-free
+ * latest-value handoff into a real-time control loop.
+ */
+template <uint8_t N>
+struct JointStateFixed {
+  int64_t timestamp = 0;                   ///< Timestamp (unit: nanoseconds)
+  std::array<SingleJointState, N> joints;  ///< State data for all joints, same order as JointState
+};
+
+/**
+ * @brief Fixed-capacity variant of SingleHandJointCommand
+ */
+struct SingleHandJointCommandFixed {
+  int16_t operation_mode = 0;                ///< Control mode (e.g., position, torque, impedance, etc.)
+  std::array<double, kHandJointNum> pos{};   ///< Desired position array, same order as SingleHandJointCommand
+};
+
+/**
+ * @brief Fixed-capacity variant of HandCommand, trivially copyable
+ */
+struct HandCommandFixed {
+  int64_t timestamp = 0;                                    ///< Timestamp (unit: nanoseconds)
+  std::array<SingleHandJointCommandFixed, kHandNum> cmd;    ///< Control commands, left hand and right hand in order
+};
+
+/**
+ * @brief Fixed-capacity variant of SingleHandJointState
+ */
+struct SingleHandJointStateFixed {
+  int16_t status_word = 0;                  ///< Status
+  std::array<double, kHandJointNum> pos{};  ///< Actual position (unit depends on controller definition)
+  std::array<double, kHandJointNum> toq{};  ///< Actual torque (unit: Nm)
+  std::array<double, kHandJointNum> cur{};  ///< Actual current (unit: A)
+  int16_t error_code = 0;                   ///< Error code (0 indicates normal)
+};
+
+/**
+ * @brief Fixed-capacity variant of HandState, trivially copyable
+ */
+struct HandStateFixed {
+  int64_t timestamp = 0;                                    ///< Timestamp (unit: nanoseconds)
+  std::array<SingleHandJointStateFixed, kHandNum> state;    ///< All hand joint states, left hand and right hand in order
+};
+
 /**
  * @brief Estimator state data structure
  */
@@ -378,6 +679,28 @@ typedef struct tts_cmd {
   TtsMode mode;
 } TtsCommand;
 
+/**
+ * @brief Voice-activity gating of the audio streams
+ *
+ * Reuses the wake-up engine's on-device voice activity detector: while gating is enabled the
+ * robot only transmits audio frames around detected voice activity, so an idle microphone
+ * costs near-zero bandwidth and host CPU.
+ */
+struct VadGateOptions {
+  bool enable = true;         ///< Gate transmission on detected voice activity
+  int32_t pre_roll_ms = 200;  ///< Audio retained from before the activity onset (unit: milliseconds)
+  int32_t post_roll_ms = 400;  ///< Audio kept flowing after the activity ends (unit: milliseconds)
+};
+
+/**
+ * @brief Format of a PCM playback stream
+ */
+struct PcmStreamConfig {
+  int32_t sample_rate = 16000;  ///< Sample rate (unit: Hz)
+  int8_t channels = 1;          ///< Number of channels, 1 (mono) or 2 (stereo)
+  int8_t bits_per_sample = 16;  ///< Bits per sample, signed little-endian
+};
+
 /************************************************************
  *                        Sensors                              *
  ************************************************************/
@@ -431,6 +754,95 @@ struct PointCloud2 {
   bool is_dense;  ///< Whether it is a dense point cloud (no invalid points)
 };
 
+/**
+ * @brief Borrowed view of a single lidar point cloud frame
+ *
+ * Unlike PointCloud2, the point payload is not copied out of the transport's receive buffer:
+ * `data` points directly into the buffer lent by the transport and stays valid until Release()
+ * is called (or the loan object is destroyed). Holding a loan for a long time can stall the
+ * transport's receive path, so consumers should parse in place and release promptly.
+ */
+struct PointCloudLoan {
+  PointCloudLoan() = default;
+  PointCloudLoan(const PointCloudLoan&) = delete;
+  PointCloudLoan& operator=(const PointCloudLoan&) = delete;
+
+  /// Move constructor, transfers buffer ownership and leaves the source loan empty.
+  PointCloudLoan(PointCloudLoan&& other)
+      : header(std::move(other.header)),
+        height(other.height),
+        width(other.width),
+        fields(std::move(other.fields)),
+        is_bigendian(other.is_bigendian),
+        point_step(other.point_step),
+        row_step(other.row_step),
+        data(other.data),
+        data_size(other.data_size),
+        is_dense(other.is_dense),
+        release_hook(std::move(other.release_hook)) {
+    other.release_hook = nullptr;
+    other.data = nullptr;
+    other.data_size = 0;
+  }
+
+  /// Move assignment, releases any buffer currently held before taking over the source's.
+  PointCloudLoan& operator=(PointCloudLoan&& other) {
+    if (this != &other) {
+      Release();
+      header = std::move(other.header);
+      height = other.height;
+      width = other.width;
+      fields = std::move(other.fields);
+      is_bigendian = other.is_bigendian;
+      point_step = other.point_step;
+      row_step = other.row_step;
+      data = other.data;
+      data_size = other.data_size;
+      is_dense = other.is_dense;
+      release_hook = std::move(other.release_hook);
+      other.release_hook = nullptr;
+      other.data = nullptr;
+      other.data_size = 0;
+    }
+    return *this;
+  }
+
+  /// Destructor, returns the borrowed buffer to the transport if still held.
+  ~PointCloudLoan() { Release(); }
+
+  /**
+   * @brief Return the borrowed buffer to the transport.
+   *
+   * After this call `data` is no longer valid. Calling Release() more than once is harmless.
+   */
+  void Release() {
+    if (release_hook) {
+      release_hook();
+      release_hook = nullptr;
+    }
+    data = nullptr;
+    data_size = 0;
+  }
+
+  Header header;  ///< Standard message header
+
+  int32_t height = 0;  ///< Number of rows
+  int32_t width = 0;   ///< Number of columns
+
+  std::vector<PointField> fields;  ///< Point field array
+
+  bool is_bigendian = false;  ///< Byte order
+  int32_t point_step = 0;     ///< Number of bytes occupied by each point
+  int32_t row_step = 0;       ///< Number of bytes occupied by each row
+
+  const uint8_t* data = nullptr;  ///< Borrowed point cloud data (packed by field), owned by the transport
+  size_t data_size = 0;           ///< Number of valid bytes behind `data`
+
+  bool is_dense = false;  ///< Whether it is a dense point cloud (no invalid points)
+
+  std::function<void()> release_hook;  ///< Installed by the transport to reclaim the buffer, invoked by Release()
+};
+
 /**
  * @brief Image data structure, supporting multiple encoding formats
  */
@@ -485,6 +897,91 @@ struct BinocularCameraFrame {
   std::vector<uint8_t> data;  ///< Left and right eye stitched image data, left half is left eye image, right half is right eye image
 };
 
+/**
+ * @brief Identifiers of the sensor data topics, used for per-topic configuration
+ */
+enum class SensorDataTopic : int8_t {
+  LIDAR_IMU = 0,              ///< Lidar IMU data
+  LIDAR_POINT_CLOUD = 1,      ///< Lidar point cloud data
+  HEAD_RGBD_COLOR_IMAGE = 2,  ///< Head RGBD color image data
+  HEAD_RGBD_DEPTH_IMAGE = 3,  ///< Head RGBD depth image data
+  BINOCULAR_IMAGE = 4,        ///< Binocular camera image frame data
+};
+
+/**
+ * @brief Compression codec of the lidar point cloud stream
+ */
+enum class PointCloudCompression : int8_t {
+  NONE = 0,  ///< Raw point cloud data, no compression
+  LZ4 = 1,   ///< LZ4 frame compression, lowest added latency
+  ZSTD = 2,  ///< zstd compression, highest ratio
+};
+
+/**
+ * @brief Lidar stream options, negotiated with the on-robot service when the lidar is opened
+ */
+struct LidarStreamOptions {
+  /**
+   * @brief Point cloud compression codec
+   *
+   * When set, the on-robot service compresses each frame before transmission and the SDK
+   * decompresses it before invoking the point cloud callbacks, so subscribers keep receiving
+   * plain PointCloud2 data at 3-5x less link bandwidth. Falls back to NONE if the robot
+   * firmware does not support the requested codec.
+   */
+  PointCloudCompression compression = PointCloudCompression::NONE;
+};
+
+/**
+ * @brief Point cloud filtering applied on the robot before transmission
+ *
+ * All filters default to disabled; enabled filters are applied in the order voxel
+ * downsampling, range/angle ROI, point cap. A filtered cloud arrives in PointCloud2::data
+ * already reduced, lowering link bandwidth and receive-side CPU.
+ */
+struct PointCloudFilterOptions {
+  double voxel_leaf_size = 0.0;  ///< Voxel grid leaf size (unit: m), 0 disables downsampling
+
+  double min_range = 0.0;  ///< Minimum point distance from the sensor (unit: m), 0 disables the near cut
+  double max_range = 0.0;  ///< Maximum point distance from the sensor (unit: m), 0 disables the far cut
+
+  double min_angle = 0.0;  ///< Start of the horizontal ROI sector (unit: rad), with max_angle == 0 the sector filter is disabled
+  double max_angle = 0.0;  ///< End of the horizontal ROI sector (unit: rad)
+
+  int32_t max_points = 0;  ///< Upper bound on points per frame after filtering, 0 disables the cap
+};
+
+/**
+ * @brief Compression codec of the binocular camera stream
+ */
+enum class ImageCompression : int8_t {
+  RAW = 0,    ///< Uncompressed stitched frames
+  MJPEG = 1,  ///< Hardware Motion-JPEG, per-frame compression
+  H264 = 2,   ///< Hardware H.264, highest ratio, requires decoding a GOP to seek
+};
+
+/**
+ * @brief Binocular camera stream options, negotiated with the on-robot service when the camera is opened
+ */
+struct BinocularStreamOptions {
+  /**
+   * @brief Image compression codec
+   *
+   * When set, the robot delivers hardware-encoded frames and BinocularCameraFrame::format
+   * carries the codec name ("mjpeg", "h264") instead of the raw format. Falls back to RAW
+   * if the robot firmware does not support the requested codec.
+   */
+  ImageCompression compression = ImageCompression::RAW;
+
+  /**
+   * @brief Decode compressed frames inside the SDK
+   *
+   * When true, the SDK decodes received frames back to the raw stitched layout before
+   * invoking SubscribeBinocularImage callbacks, trading host CPU for the raw-frame API.
+   */
+  bool decode_to_raw = false;
+};
+
 /**
  * @brief Voice wake-up status structure
  */
@@ -532,6 +1029,36 @@ struct Odometry {
   std::array<double, 3> angular_velocity;  ///< Angular velocity (x, y, z)
 };
 
+/**
+ * @brief Interned coordinate frame identifiers used by fixed-layout messages
+ *
+ * Replaces the per-message frame_id strings of Header with an enumeration, since the frames
+ * are identical on every sample of a stream.
+ */
+enum class FrameId : int8_t {
+  UNKNOWN = 0,    ///< Unknown frame
+  MAP = 1,        ///< Map frame
+  ODOM = 2,       ///< Odometry frame
+  BASE_LINK = 3,  ///< Robot body frame
+};
+
+/**
+ * @brief Fixed-layout variant of Odometry
+ *
+ * Trivially copyable: frame ids are interned FrameId values instead of strings and all fields
+ * are fixed arrays, so a 200Hz+ stream can be handed into a control loop through a lock-free
+ * latest-value slot without any per-message allocation.
+ */
+struct OdometryFixed {
+  int64_t timestamp = 0;                          ///< Timestamp, unit: nanoseconds
+  FrameId frame_id = FrameId::UNKNOWN;            ///< Coordinate frame of the pose
+  FrameId child_frame_id = FrameId::UNKNOWN;      ///< Child frame of the twist
+  std::array<double, 3> position{};               ///< Position (x, y, z)
+  std::array<double, 4> orientation{};            ///< Orientation (w, x, y, z)
+  std::array<double, 3> linear_velocity{};        ///< Linear velocity (x, y, z)
+  std::array<double, 3> angular_velocity{};       ///< Angular velocity (x, y, z)
+};
+
 class NonCopyable {
  protected:
   NonCopyable() = default;
@@ -546,6 +1073,13 @@ class NonCopyable {
  *                     Slam and Navigation                  *
  ************************************************************/
 
+/**
+ * @brief Identifiers of the slam/navigation data topics, used for per-topic configuration
+ */
+enum class SlamDataTopic : int8_t {
+  ODOMETRY = 0,  ///< Odometry data
+};
+
 /**
  * @brief SLAM mode enumeration type
  */
@@ -623,6 +1157,59 @@ struct AllMapInfo {
   std::vector<MapInfo> map_infos;  // All map information
 };
 
+/**
+ * @brief Odometry stream options
+ */
+struct OdometryStreamOptions {
+  int32_t rate_hz = 50;       ///< Publish rate requested from the robot (unit: Hz)
+  bool fixed_layout = false;  ///< Deliver OdometryFixed messages (see SubscribeOdometryFixed/PollOdometry) instead of Odometry
+};
+
+/**
+ * @brief Map metadata without the image payload
+ *
+ * Carries everything needed to list and lay out a map except MapImageData::image,
+ * so enumerating many stored maps stays cheap.
+ */
+struct MapMetaInfo {
+  std::string map_name;         // Map name
+  double resolution = 0.0;      // Map resolution, unit: m/pixel
+  Pose3DEuler origin;           // Map origin, origin of the world coordinate system relative to the map’s lower-left corner
+  uint32_t width = 0;           // image width
+  uint32_t height = 0;          // image height
+};
+
+/**
+ * @brief Metadata of all stored maps
+ */
+struct AllMapMetaInfo {
+  std::string current_map_name;        // Current map name
+  std::vector<MapMetaInfo> map_metas;  // Metadata of all stored maps
+};
+
+/**
+ * @brief Options of a pipelined map transfer
+ *
+ * Instead of one serial transfer of the raw PGM payload, the map image is split into tiles
+ * that are compressed and moved over parallel streams with overlapping compression and IO
+ * stages, and the transfer runs on its own channel so concurrent navigation RPCs are not
+ * blocked behind it.
+ */
+struct MapTransferOptions {
+  int32_t tile_size = 256;        ///< Tile edge length (unit: pixel)
+  int32_t parallel_streams = 4;   ///< Number of tiles compressed and transferred concurrently
+  bool compress = true;           ///< Compress tiles before transmission
+};
+
+/**
+ * @brief Progress of a pipelined map transfer
+ */
+struct MapTransferProgress {
+  uint32_t tiles_total = 0;        ///< Total number of tiles in the transfer
+  uint32_t tiles_done = 0;         ///< Tiles fully transferred so far
+  uint64_t bytes_transferred = 0;  ///< Compressed bytes moved so far
+};
+
 /**
  * @brief Current localization information structure
  */